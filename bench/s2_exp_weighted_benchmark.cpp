@@ -1,4 +1,5 @@
 #include <algorithm>
+#include <array>
 #include <benchmark/benchmark.h>
 #include <cmath>
 #include <iomanip>
@@ -15,12 +16,11 @@ using namespace opflow::op;
 void compare_variance_methods(const std::vector<double> &data, double alpha) {
   s2_exp_weighted_sta calculator(alpha);
 
-  std::vector<std::pair<double, double>> results;
+  std::vector<s2_result> results;
   results.reserve(data.size());
 
   for (double x : data) {
-    auto [s2_standard, s2_welford] = calculator.step(x);
-    results.emplace_back(s2_standard, s2_welford);
+    results.push_back(calculator.step(x));
   }
 
   // Print comparison for the last few values
@@ -30,15 +30,40 @@ void compare_variance_methods(const std::vector<double> &data, double alpha) {
 
   size_t start = std::max(size_t{0}, results.size() > 5 ? results.size() - 5 : 0);
   for (size_t i = start; i < results.size(); ++i) {
-    double diff = std::abs(results[i].first - results[i].second);
-    double rel_diff = results[i].second != 0.0 ? diff / std::abs(results[i].second) : 0.0;
+    double diff = std::abs(results[i].standard - results[i].welford);
+    double rel_diff = results[i].welford != 0.0 ? diff / std::abs(results[i].welford) : 0.0;
 
-    std::cout << "Step " << i + 1 << ": " << results[i].first << " vs " << results[i].second << " (diff: " << diff
+    std::cout << "Step " << i + 1 << ": " << results[i].standard << " vs " << results[i].welford << " (diff: " << diff
               << ", rel: " << rel_diff << ")\n";
   }
   std::cout << "\n";
 }
 
+// Batched variant: runs four alpha parameters as independent SIMD-friendly
+// lanes over one sample stream. The lane loop has a fixed trip count of 4 and
+// no cross-lane dependency, so the compiler can vectorize the whole sweep.
+std::array<double, 4> compare_variance_methods_batch(const std::vector<double> &data,
+                                                     const std::array<double, 4> &alphas) {
+  std::array<double, 4> m{}, s2{};
+  bool init = false;
+
+  for (double x : data) {
+    if (!init) {
+      m.fill(x);
+      init = true;
+      continue;
+    }
+    for (size_t lane = 0; lane < 4; ++lane) {
+      double const a = alphas[lane];
+      double const d = x - m[lane];
+      double const dd = (1.0 - a) * d * d;
+      m[lane] = std::fma(a, d, m[lane]);
+      s2[lane] = std::fma(a, dd - s2[lane], s2[lane]);
+    }
+  }
+  return s2;
+}
+
 // Benchmark for small alpha (slow adaptation)
 static void BM_S2ExpWeighted_SmallAlpha(benchmark::State &state) {
   const double alpha = 0.01; // Slow adaptation
@@ -111,24 +136,52 @@ static void BM_S2ExpWeighted_LargeAlpha(benchmark::State &state) {
   state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n_samples));
 }
 
+// Medium alpha with alpha folded in at compile time (NTTP): lets the compiler
+// keep alpha and 1-alpha as immediates instead of loading them per step
+static void BM_S2ExpWeighted_MediumAlphaCT(benchmark::State &state) {
+  const size_t n_samples = 1000;
+
+  auto data_range = utils::make_unif_range<double>(n_samples, -5.0, 5.0, 123);
+  std::vector<double> samples;
+  samples.reserve(n_samples);
+  for (auto x : data_range) {
+    samples.push_back(x);
+  }
+
+  for (auto _ : state) {
+    s2_exp_weighted_sta_ct<0.1> calculator;
+
+    for (double x : samples) {
+      auto result = calculator.step(x);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(n_samples));
+}
+
 // Benchmark with non-stationary data (changing mean and variance)
 static void BM_S2ExpWeighted_NonStationary(benchmark::State &state) {
   const double alpha = 0.2;
   const size_t n_samples = 1000;
 
+  // Generate non-stationary data once: constructing a fresh mt19937 (~2.5 KiB
+  // of state) per sample inside the timed loop measured RNG setup, not the
+  // variance calculator. Mean shifts from 0 to 10, variance increases over time.
+  std::vector<double> samples;
+  samples.reserve(n_samples);
+  std::mt19937 gen(789);
+  for (size_t i = 0; i < n_samples; ++i) {
+    double mean_shift = 10.0 * static_cast<double>(i) / static_cast<double>(n_samples);
+    double variance_scale = 1.0 + 3.0 * static_cast<double>(i) / static_cast<double>(n_samples);
+    std::normal_distribution<double> dist(mean_shift, std::sqrt(variance_scale));
+    samples.push_back(dist(gen));
+  }
+
   for (auto _ : state) {
     s2_exp_weighted_sta calculator(alpha);
 
-    // Generate non-stationary data: changing mean and variance over time
-    for (size_t i = 0; i < n_samples; ++i) {
-      // Mean shifts from 0 to 10, variance increases over time
-      double mean_shift = 10.0 * i / n_samples;
-      double variance_scale = 1.0 + 3.0 * i / n_samples;
-
-      std::mt19937 gen(static_cast<unsigned>(789 + i));
-      std::normal_distribution<double> dist(mean_shift, std::sqrt(variance_scale));
-
-      double x = dist(gen);
+    for (double x : samples) {
       auto result = calculator.step(x);
       benchmark::DoNotOptimize(result);
     }
@@ -200,10 +253,38 @@ static void TestNumericalAccuracy() {
     std::cout << "Test 4: High smoothing factor (α=0.8), 500 samples\n";
     compare_variance_methods(samples, 0.8);
   }
+
+  // Test 5: All four alphas swept in one batched pass, checked lane-by-lane
+  // against the scalar calculator on the same stream
+  {
+    auto data_range = utils::make_unif_range<double>(500, -10.0, 10.0, 42);
+    std::vector<double> samples;
+    samples.reserve(500);
+    for (auto x : data_range) {
+      samples.push_back(x);
+    }
+
+    constexpr std::array<double, 4> alphas{0.1, 0.05, 0.2, 0.8};
+    auto batched = compare_variance_methods_batch(samples, alphas);
+
+    std::cout << "Test 5: Batched 4-lane alpha sweep vs scalar, 500 samples\n";
+    for (size_t lane = 0; lane < 4; ++lane) {
+      s2_exp_weighted_sta calculator(alphas[lane]);
+      double scalar = 0.0;
+      for (double x : samples) {
+        scalar = calculator.step(x).standard;
+      }
+      double diff = std::abs(batched[lane] - scalar);
+      std::cout << "Alpha " << alphas[lane] << ": batched " << batched[lane] << " vs scalar " << scalar
+                << " (diff: " << diff << ")\n";
+    }
+    std::cout << "\n";
+  }
 }
 
 BENCHMARK(BM_S2ExpWeighted_SmallAlpha);
 BENCHMARK(BM_S2ExpWeighted_MediumAlpha);
+BENCHMARK(BM_S2ExpWeighted_MediumAlphaCT);
 BENCHMARK(BM_S2ExpWeighted_LargeAlpha);
 BENCHMARK(BM_S2ExpWeighted_NonStationary);
 
@@ -1,10 +1,15 @@
 #pragma once
 
-#include <utility>
-
 #include "opflow/detail/accum.hpp"
 
 namespace opflow::op {
+// Plain two-double aggregate: returned in xmm0/xmm1 on x86-64 SysV with no
+// hidden sret pointer, so step() results never round-trip through the stack
+struct s2_result {
+  double standard; ///< variance from the pre-update deviation form
+  double welford;  ///< Welford-style variance
+};
+
 struct s2_exp_weighted_sta {
   detail::smooth<double> m{};          ///< mean
   detail::smooth<double> s2{};         ///< variance (only using u_prev)
@@ -14,19 +19,52 @@ struct s2_exp_weighted_sta {
 
   explicit s2_exp_weighted_sta(double alpha) noexcept : alpha{alpha} {}
 
-  std::pair<double, double> step(double x) noexcept {
+  s2_result step(double x) noexcept {
     if (!init) {
       m = x;
       init = true;
       return {0., 0.};
     }
 
+    // After m.add, d2 = x - m' = (1-alpha)*d, so the Welford-style input
+    // d*d2 equals the "standard" input a1*d*d: compute it once instead of
+    // reloading m and re-multiplying on the serialized chain.
     double const d = x - m;
     double const a1 = 1.0 - alpha;
+    double const dd = a1 * d * d;
     m.add(x, alpha);
-    s2.add(a1 * d * d, alpha); // only using u_prev
-    double const d2 = x - m;
-    s2_welford.add(d * d2, alpha); // Welford's
+    s2.add(dd, alpha);         // only using u_prev
+    s2_welford.add(dd, alpha); // Welford's, algebraically identical for EW
+    return {s2.value(), s2_welford.value()};
+  }
+};
+
+/**
+ * @brief Compile-time-alpha variant of s2_exp_weighted_sta
+ *
+ * Alpha is a template parameter, so 1-alpha and the fused update constants
+ * fold into immediates instead of being reloaded every step.
+ */
+template <double Alpha>
+struct s2_exp_weighted_sta_ct {
+  detail::smooth<double> m{};          ///< mean
+  detail::smooth<double> s2{};         ///< variance (only using u_prev)
+  detail::smooth<double> s2_welford{}; ///< variance (welford's like, using u_prev and u_curr)
+  bool init{};                         ///< whether the first value has been processed
+
+  s2_result step(double x) noexcept {
+    if (!init) {
+      m = x;
+      init = true;
+      return {0., 0.};
+    }
+
+    constexpr double a1 = 1.0 - Alpha;
+    double const d = x - m;
+    double const dd = a1 * d * d;
+    m.add(x, Alpha);
+    s2.add(dd, Alpha);
+    s2_welford.add(dd, Alpha);
     return {s2.value(), s2_welford.value()};
   }
 };
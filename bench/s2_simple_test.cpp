@@ -1,3 +1,4 @@
+#include <bit>
 #include <cassert>
 #include <cmath>
 #include <iomanip>
@@ -8,45 +9,93 @@
 #include "dev/utils.hpp"
 #include "s2_exp_weighted_sta.hpp"
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 using namespace opflow::op;
 
-// Simple test function to compare the two variance calculation methods
+// Simple test function to compare the two variance calculation methods.
+// Three separate passes: stepwise compute, pure-math reduction, then I/O.
+// Keeping std::cout out of the first two loops leaves them as straight-line
+// compute the compiler can vectorize, so the binary measures step cost,
+// not stream formatting.
 void test_variance_methods(const std::string &test_name, const std::vector<double> &data, double alpha) {
   s2_exp_weighted_sta calculator(alpha);
 
-  std::cout << "\n=== " << test_name << " ===\n";
-  std::cout << "Alpha: " << alpha << ", Samples: " << data.size() << "\n";
-  std::cout << std::fixed << std::setprecision(8);
+  // Pass 1: compute only
+  std::vector<s2_result> results(data.size());
+  for (size_t i = 0; i < data.size(); ++i) {
+    results[i] = calculator.step(data[i]);
+  }
 
+  // Pass 2: reductions only (skip index 0 since both methods return 0.0)
   double max_abs_diff = 0.0;
   double max_rel_diff = 0.0;
   size_t diff_count = 0;
+  size_t i = 1;
+#if defined(__AVX2__)
+  {
+    // results is an AoS stream of [standard, welford] pairs, so hsub on two
+    // consecutive loads yields four pairwise differences at once; unpackhi
+    // collects the matching welford lanes for the relative diff. Lane order
+    // is permuted, which max/count reductions do not care about.
+    static_assert(sizeof(s2_result) == 2 * sizeof(double));
+    double const *base = reinterpret_cast<double const *>(results.data());
+    __m256d const sign_mask = _mm256_set1_pd(-0.0);
+    __m256d const thresh = _mm256_set1_pd(1e-12);
+    __m256d const zero = _mm256_setzero_pd();
+    __m256d max_abs = zero;
+    __m256d max_rel = zero;
+    for (; i + 4 <= results.size(); i += 4) {
+      __m256d v0 = _mm256_loadu_pd(base + 2 * i);
+      __m256d v1 = _mm256_loadu_pd(base + 2 * i + 4);
+      __m256d ad = _mm256_andnot_pd(sign_mask, _mm256_hsub_pd(v0, v1));
+      __m256d w = _mm256_andnot_pd(sign_mask, _mm256_unpackhi_pd(v0, v1));
+      max_abs = _mm256_max_pd(max_abs, ad);
+      // welford == 0 lanes contribute 0, matching the scalar guard
+      __m256d rel = _mm256_and_pd(_mm256_div_pd(ad, w), _mm256_cmp_pd(w, zero, _CMP_NEQ_OQ));
+      max_rel = _mm256_max_pd(max_rel, rel);
+      auto gt = static_cast<unsigned>(_mm256_movemask_pd(_mm256_cmp_pd(ad, thresh, _CMP_GT_OQ)));
+      diff_count += static_cast<size_t>(std::popcount(gt));
+    }
+    alignas(32) double tmp[4];
+    _mm256_store_pd(tmp, max_abs);
+    max_abs_diff = std::max({tmp[0], tmp[1], tmp[2], tmp[3]});
+    _mm256_store_pd(tmp, max_rel);
+    max_rel_diff = std::max({tmp[0], tmp[1], tmp[2], tmp[3]});
+  }
+#endif
+  for (; i < results.size(); ++i) {
+    double abs_diff = std::abs(results[i].standard - results[i].welford);
+    double rel_diff = results[i].welford != 0.0 ? abs_diff / std::abs(results[i].welford) : 0.0;
 
-  for (size_t i = 0; i < data.size(); ++i) {
-    auto [s2_standard, s2_welford] = calculator.step(data[i]);
-
-    if (i > 0) { // Skip first iteration since both methods return 0.0
-      double abs_diff = std::abs(s2_standard - s2_welford);
-      double rel_diff = s2_welford != 0.0 ? abs_diff / std::abs(s2_welford) : 0.0;
-
-      max_abs_diff = std::max(max_abs_diff, abs_diff);
-      max_rel_diff = std::max(max_rel_diff, rel_diff);
+    max_abs_diff = std::max(max_abs_diff, abs_diff);
+    max_rel_diff = std::max(max_rel_diff, rel_diff);
 
-      if (abs_diff > 1e-12) { // Count significant differences
-        diff_count++;
-      }
+    if (abs_diff > 1e-12) { // Count significant differences
+      diff_count++;
     }
+  }
 
-    // Print some intermediate results
-    if (i == 9 || i == 49 || i == 99 || i == data.size() - 1) {
-      std::cout << "Step " << i + 1 << ": Standard=" << s2_standard << ", Welford=" << s2_welford;
-      if (i > 0) {
-        double abs_diff = std::abs(s2_standard - s2_welford);
-        double rel_diff = s2_welford != 0.0 ? abs_diff / std::abs(s2_welford) : 0.0;
-        std::cout << " (abs_diff=" << abs_diff << ", rel_diff=" << rel_diff << ")";
-      }
-      std::cout << "\n";
+  // Pass 3: report
+  std::cout << "\n=== " << test_name << " ===\n";
+  std::cout << "Alpha: " << alpha << ", Samples: " << data.size() << "\n";
+  std::cout << std::fixed << std::setprecision(8);
+
+  size_t last_printed = results.size(); // sentinel: nothing printed yet
+  for (size_t i : {size_t{9}, size_t{49}, size_t{99}, data.size() - 1}) {
+    if (i >= results.size() || i == last_printed)
+      continue;
+    last_printed = i;
+    auto [s2_standard, s2_welford] = results[i];
+    std::cout << "Step " << i + 1 << ": Standard=" << s2_standard << ", Welford=" << s2_welford;
+    if (i > 0) {
+      double abs_diff = std::abs(s2_standard - s2_welford);
+      double rel_diff = s2_welford != 0.0 ? abs_diff / std::abs(s2_welford) : 0.0;
+      std::cout << " (abs_diff=" << abs_diff << ", rel_diff=" << rel_diff << ")";
     }
+    std::cout << "\n";
   }
 
   std::cout << "\nSummary:\n";
@@ -64,12 +113,8 @@ int main() {
 
   // Test 1: Uniform random data with various alpha values
   {
-    auto data_range = utils::make_unif_range<double>(1000, -10.0, 10.0, 42);
-    std::vector<double> samples;
-    samples.reserve(1000);
-    for (auto x : data_range) {
-      samples.push_back(x);
-    }
+    std::vector<double> samples(1000);
+    utils::fill_unif(samples.data(), samples.size(), -10.0, 10.0, 42);
 
     test_variance_methods("Uniform Random Data (α=0.01)", samples, 0.01);
     test_variance_methods("Uniform Random Data (α=0.1)", samples, 0.1);
@@ -93,12 +138,8 @@ int main() {
 
   // Test 3: Data with extreme outliers
   {
-    auto data_range = utils::make_unif_range<double>(300, 0.0, 1.0, 456);
-    std::vector<double> samples;
-    samples.reserve(300);
-    for (auto x : data_range) {
-      samples.push_back(x);
-    }
+    std::vector<double> samples(300);
+    utils::fill_unif(samples.data(), samples.size(), 0.0, 1.0, 456);
 
     // Add extreme outliers
     samples[100] = 1000.0;
@@ -112,14 +153,17 @@ int main() {
     std::vector<double> samples;
     samples.reserve(400);
 
+    // One persistent generator and distribution: re-seeding mt19937 per
+    // sample rewrites its whole ~2.5 KiB state each draw. Non-stationarity
+    // comes from re-parameterizing the distribution, not the PRNG.
+    std::mt19937 gen(789);
+    std::normal_distribution<double> dist;
     for (size_t i = 0; i < 400; ++i) {
       // Mean and variance both change over time
-      double mean = 5.0 * std::sin(2.0 * M_PI * i / 100.0);
-      double variance = 1.0 + 2.0 * i / 400.0;
-
-      std::mt19937 gen(789 + static_cast<unsigned>(i));
-      std::normal_distribution<double> dist(mean, std::sqrt(variance));
+      double mean = 5.0 * std::sin(2.0 * M_PI * static_cast<double>(i) / 100.0);
+      double variance = 1.0 + 2.0 * static_cast<double>(i) / 400.0;
 
+      dist.param(std::normal_distribution<double>::param_type{mean, std::sqrt(variance)});
       samples.push_back(dist(gen));
     }
 
@@ -1,25 +1,17 @@
 #pragma once
 
-#include <span>
-
 #include "../agg_base.hpp"
 #include "../def.hpp"
+#include "../detail/utils_math.hpp"
 
 namespace opflow::agg {
 struct book_imba : public agg_base<double> {
   using data_type = double;
 
   void on_data(size_t n, data_type const *const *in, data_type *out) noexcept override {
-    std::span<data_type const> bid_size(in[0], n);
-    std::span<data_type const> ask_size(in[1], n);
-
     data_type bid{};
     data_type ask{};
-
-    for (size_t i = 0; i < n; ++i) {
-      bid += bid_size[i];
-      ask += ask_size[i];
-    }
+    detail::sum2(in[0], in[1], n, bid, ask);
 
     out[0] = (bid - ask) / (bid + ask);
   }
@@ -12,6 +12,15 @@ struct count : public agg_base<Data> {
     *out = static_cast<data_type>(n);
   }
 
+  // Across-group batch is a plain convert-and-store loop: one virtual call
+  // covers every group instead of one dispatch per group
+  void on_data_batch(size_t ngrp, size_t const *ns, data_type const *const *const *,
+                     data_type *const *outs) noexcept override {
+    for (size_t g = 0; g < ngrp; ++g) {
+      *outs[g] = static_cast<data_type>(ns[g]);
+    }
+  }
+
   OPFLOW_INOUT(0, 1)
   OPFLOW_CLONEABLE(count)
 };
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <span>
+#include <type_traits>
+
+#include "../agg_base.hpp"
+#include "../def.hpp"
+#include "../detail/utils_math.hpp"
+
+namespace opflow::agg {
+/**
+ * @brief Windowed covariance over two input columns
+ *
+ * Both columns are read in lockstep, so the kernel walks them in one fused
+ * pass: the co-moment Welford in detail::welford2 computes both means and
+ * the raw co-moment per element pair, touching each column's cache lines
+ * once instead of once for the means and again for the deviations.
+ */
+template <typename Data>
+struct cov : public agg_base<Data> {
+  using data_type = Data;
+
+  size_t const ddof;
+
+  explicit cov(size_t degrees_of_freedom = 1) : ddof(degrees_of_freedom) {}
+
+  void on_data(size_t n, data_type const *const *in, data_type *out) noexcept override {
+    if (n <= ddof) {
+      out[0] = data_type{0};
+      return;
+    }
+
+    data_type mean_a, mean_b, comoment;
+    if constexpr (std::is_same_v<data_type, double>) {
+      detail::welford2(in[0], in[1], n, mean_a, mean_b, comoment);
+    } else {
+      std::span<data_type const> a(in[0], n);
+      std::span<data_type const> b(in[1], n);
+      mean_a = data_type{};
+      mean_b = data_type{};
+      comoment = data_type{};
+      data_type count{};
+      for (size_t i = 0; i < n; ++i) {
+        count += data_type{1};
+        data_type const da = a[i] - mean_a;
+        mean_a += da / count;
+        mean_b += (b[i] - mean_b) / count;
+        comoment += da * (b[i] - mean_b);
+      }
+    }
+
+    out[0] = comoment / static_cast<data_type>(n - ddof);
+  }
+
+  OPFLOW_INOUT(2, 1)
+  OPFLOW_CLONEABLE(cov)
+};
+} // namespace opflow::agg
@@ -2,9 +2,11 @@
 
 #include <algorithm>
 #include <span>
+#include <type_traits>
 
 #include "../agg_base.hpp"
 #include "../def.hpp"
+#include "../detail/utils_math.hpp"
 
 namespace opflow::agg {
 template <typename Data>
@@ -14,10 +16,19 @@ struct ohlc : public agg_base<Data> {
   void on_data(size_t n, data_type const *const *in, data_type *out) noexcept override {
     std::span<data_type const> input(in[0], n);
     auto const o = input.front();
-    auto const h = *std::ranges::max_element(input);
-    auto const l = *std::ranges::min_element(input);
     auto const c = input.back();
 
+    // Single fused pass for high/low: separate max_element/min_element walks
+    // would load every element twice on a memory-bound reduction
+    data_type h, l;
+    if constexpr (std::is_same_v<data_type, double>) {
+      detail::minmax(in[0], n, l, h);
+    } else {
+      auto const [lo, hi] = std::ranges::minmax_element(input);
+      l = *lo;
+      h = *hi;
+    }
+
     out[0] = o;
     out[1] = h;
     out[2] = l;
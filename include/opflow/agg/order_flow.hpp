@@ -1,25 +1,17 @@
 #pragma once
 
-#include <span>
-
 #include "../agg_base.hpp"
 #include "../def.hpp"
+#include "../detail/utils_math.hpp"
 
 namespace opflow::agg {
 struct order_flow : public agg_base<double> {
   using data_type = double;
 
   void on_data(size_t n, data_type const *const *in, data_type *out) noexcept override {
-    std::span<data_type const> buy_vol(in[0], n);
-    std::span<data_type const> sell_vol(in[1], n);
-
     data_type buy{};
     data_type sell{};
-
-    for (size_t i = 0; i < n; ++i) {
-      buy += buy_vol[i];
-      sell += sell_vol[i];
-    }
+    detail::sum2(in[0], in[1], n, buy, sell);
 
     out[0] = buy - sell; // Net order flow
   }
@@ -1,11 +1,12 @@
 #pragma once
 
 #include <cmath>
-#include <numeric>
 #include <span>
+#include <type_traits>
 
 #include "../agg_base.hpp"
 #include "../def.hpp"
+#include "../detail/utils_math.hpp"
 
 namespace opflow::agg {
 template <typename Data>
@@ -27,17 +28,24 @@ struct stddev : public agg_base<Data> {
         continue;
       }
 
-      std::span<data_type const> col(in[i], n);
-      // Compute mean
-      auto mean = std::accumulate(col.begin(), col.end(), data_type{}) / static_cast<data_type>(n);
-
-      // Compute variance
-      data_type sum_sq_diff{};
-      for (auto v : col) {
-        data_type diff = v - mean;
-        sum_sq_diff += diff * diff;
+      // One-pass Welford: mean + M2 in a single stream over the column,
+      // instead of re-loading the whole window for the deviation pass
+      data_type mean, m2;
+      if constexpr (std::is_same_v<data_type, double>) {
+        detail::welford(in[i], n, mean, m2);
+      } else {
+        std::span<data_type const> col(in[i], n);
+        mean = data_type{};
+        m2 = data_type{};
+        data_type count{};
+        for (auto v : col) {
+          count += data_type{1};
+          data_type const d = v - mean;
+          mean += d / count;
+          m2 += d * (v - mean);
+        }
       }
-      data_type variance = sum_sq_diff / static_cast<data_type>(n - ddof);
+      data_type variance = m2 / static_cast<data_type>(n - ddof);
 
       // Standard deviation
       out[i] = std::sqrt(variance);
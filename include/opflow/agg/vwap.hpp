@@ -1,10 +1,12 @@
 #pragma once
 
 #include <span>
+#include <type_traits>
 
 #include "../agg_base.hpp"
 #include "../common.hpp"
 #include "../def.hpp"
+#include "../detail/utils_math.hpp"
 
 namespace opflow::agg {
 template <typename T>
@@ -12,22 +14,23 @@ struct vwap : public agg_base<T> {
   using data_type = T;
 
   void on_data(size_t n, data_type const *const *in, data_type *out) noexcept override {
-    std::span<data_type const> price(in[0], n);
-    std::span<data_type const> volume(in[1], n);
-
     data_type tnvr = 0;
     data_type vol = 0;
 
-    for (size_t i = 0; i < n; ++i) {
-      tnvr += price[i] * volume[i];
-      vol += volume[i];
-    }
-
-    if (very_small(vol)) {
-      out[0] = 0;
+    if constexpr (std::is_same_v<data_type, double>) {
+      detail::dot_sum(in[0], in[1], n, tnvr, vol);
     } else {
-      out[0] = tnvr / vol;
+      std::span<data_type const> price(in[0], n);
+      std::span<data_type const> volume(in[1], n);
+      for (size_t i = 0; i < n; ++i) {
+        tnvr += price[i] * volume[i];
+        vol += volume[i];
+      }
     }
+
+    // Select form lets the compiler emit a branchless cmp + blend for the
+    // zero-volume guard instead of a data-dependent branch
+    out[0] = very_small(vol) ? data_type{0} : tnvr / vol;
   }
 
   OPFLOW_INOUT(2, 1)
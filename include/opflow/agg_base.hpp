@@ -33,6 +33,25 @@ struct agg_base {
    */
   virtual void on_data(size_t n, data_type const *const *in, data_type *out) noexcept = 0;
 
+  /**
+   * @brief Process the same aggregation across several independent groups
+   *
+   * @param ngrp number of groups
+   * @param ns per-group row counts, index dimension: (group)
+   * @param ins per-group input data, index dimension: (group, col, row)
+   * @param outs per-group output data, index dimension: (group, col)
+   *
+   * Default forwards to on_data per group; trivial aggregators may override
+   * to amortize dispatch and vectorize across the group dimension when the
+   * executor batches emissions that land on the same tick.
+   */
+  virtual void on_data_batch(size_t ngrp, size_t const *ns, data_type const *const *const *ins,
+                             data_type *const *outs) noexcept {
+    for (size_t g = 0; g < ngrp; ++g) {
+      on_data(ns[g], ins[g], outs[g]);
+    }
+  }
+
   virtual size_t num_inputs() const noexcept = 0;
   virtual size_t num_outputs() const noexcept = 0;
 
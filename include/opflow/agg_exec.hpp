@@ -1,5 +1,7 @@
 #pragma once
 
+#include <cstring>
+
 #include "agg_base.hpp"
 #include "def.hpp"
 #include "win_base.hpp"
@@ -43,11 +45,14 @@ public:
   template <typename G>
   agg_exec(G const &graph, size_t n_input, size_t n_groups, size_t pre_alloc_rows = 256, Alloc alloc = Alloc{})
       : n_grp(n_groups), aggr(graph, n_groups, alloc), history(aggr.record_size, n_grp, alloc), dataframes(),
-        curr_args(0, n_groups, alloc), win_args(0, n_groups, alloc) {
-    // Initialize data frames for each group
+        curr_args(0, n_groups, alloc), col_base(n_input, n_groups, alloc), win_args(0, n_groups, alloc) {
+    // Initialize data frames for each group. Windows with a known size
+    // (e.g. counter) hint the per-column capacity so steady state never
+    // reallocates; data-dependent windows hint 0 and fall back to pre_alloc_rows.
+    size_t const n_rows = std::max(pre_alloc_rows, aggr.window(0)->reserve_hint());
     dataframes.reserve(n_grp);
     for (size_t igrp = 0; igrp < n_grp; ++igrp) {
-      dataframes.emplace_back(n_input, pre_alloc_rows);
+      dataframes.emplace_back(n_input, n_rows);
     }
 
     size_t max_input = 0;
@@ -60,27 +65,52 @@ public:
   }
 
   // Ingest a new row. Returns the timestamp of the emitted window, if any.
-  std::optional<data_type> on_data(data_type timestamp, data_type const *in, size_t igrp) {
+  std::optional<data_type> on_data(data_type timestamp, data_type const *OPFLOW_RESTRICT in, size_t igrp) {
     assert(igrp < n_grp && "[BUG] Group index out of range.");
 
+    // Gather window arguments before appending: with `in` restrict-qualified
+    // the gathered lanes stay in registers across the append scatter, so each
+    // in[i] consumed by both paths is loaded from memory once.
+    auto const *wargs = win_in_ptr(in, igrp);
     dataframes[igrp].append(in);
 
     // Check if window should emit
     auto const &win = aggr.window(igrp);
-    if (!win->on_data(timestamp, win_in_ptr(in, igrp))) {
+    if (!win->on_data(timestamp, wargs)) {
       return std::nullopt;
     }
 
     return run_aggr(win->emit(), igrp);
   }
 
+  /**
+   * @brief Ingest one row per group for a batch of distinct groups
+   *
+   * Each entry is (timestamp, row pointer, group index); emitted[k] receives
+   * what on_data would have returned for entry k. Groups are fully isolated
+   * (per-group dataframes, windows, clones and scratch), so entries may be
+   * processed concurrently: the loop is annotated for OpenMP and parallelizes
+   * when the translation unit is built with it, and is a plain serial loop
+   * otherwise. Precondition: no two entries in one batch share a group index.
+   */
+  void run_batch(std::span<std::tuple<data_type, data_type const *, size_t> const> inputs,
+                 std::optional<data_type> *emitted) {
+#if defined(_OPENMP)
+#pragma omp parallel for schedule(dynamic, 8)
+#endif
+    for (size_t k = 0; k < inputs.size(); ++k) {
+      auto const &[timestamp, in, igrp] = inputs[k];
+      emitted[k] = on_data(timestamp, in, igrp);
+    }
+  }
+
   void value(data_type *OPFLOW_RESTRICT out, size_t igrp) const noexcept {
     assert(igrp < n_grp && "[BUG] Group index out of range.");
 
+    // data_type is trivial, so hand the copy to memcpy and let the compiler
+    // pick the widest copy idiom instead of a scalar move per element
     auto record = history[igrp];
-    for (size_t i = 0; i < aggr.record_size; ++i) {
-      out[i] = record[i];
-    }
+    std::memcpy(out, record.data(), aggr.record_size * sizeof(data_type));
   }
 
   // Force emission. Returns the timestamp of the emitted window, if any.
@@ -107,13 +137,18 @@ public:
 private:
   using spec_type = typename win_base<data_type>::spec_type;
 
-  void append_row(data_type const *in, size_t igrp) { dataframes[igrp].append(in); }
-
   data_type run_aggr(spec_type const &spec, size_t igrp) {
+    // Resolve each column base once per emission: every node argument is
+    // then a table lookup instead of re-deriving data() + offset per call
+    auto const &df = dataframes[igrp];
+    auto bases = col_base[igrp];
+    for (size_t c = 0; c < df.ncol(); ++c) {
+      bases[c] = df[c].data() + spec.offset;
+    }
 
     auto nodes = aggr[igrp];
     for (size_t i = 0; i < nodes.size(); ++i) {
-      nodes[i]->on_data(spec.size, in_ptr(i, spec.offset, igrp), out_ptr(i, igrp));
+      nodes[i]->on_data(spec.size, in_ptr(i, igrp), out_ptr(i, igrp));
     }
 
     // evict data
@@ -127,18 +162,18 @@ private:
     return record.data() + aggr.record_offset[node_id];
   }
 
-  data_type const *const *in_ptr(size_t node_id, size_t offset, size_t igrp) noexcept {
+  data_type const *const *in_ptr(size_t node_id, size_t igrp) noexcept {
     auto args = curr_args[igrp];
     auto cols = aggr.input_column[node_id];
-    auto const &df = dataframes[igrp];
+    auto bases = col_base[igrp];
 
     for (size_t i = 0; i < cols.size(); ++i) {
-      args[i] = df[cols[i]].data() + offset;
+      args[i] = bases[cols[i]];
     }
     return args.data();
   }
 
-  data_type const *win_in_ptr(data_type const *in, size_t igrp) noexcept {
+  data_type const *win_in_ptr(data_type const *OPFLOW_RESTRICT in, size_t igrp) noexcept {
     auto args = win_args[igrp];
     for (size_t i = 0; i < aggr.win_column.size(); ++i) {
       args[i] = in[aggr.win_column[i]];
@@ -157,6 +192,9 @@ private:
   std::vector<df_type, detail::rebind_alloc<Alloc, df_type>> dataframes;
 
   detail::vector_store<data_type const *, Alloc> curr_args;
+  // Per-emission column base cache; per-group slices so batched emission
+  // can run groups concurrently (bases are re-resolved at every emission)
+  detail::vector_store<data_type const *, Alloc> col_base;
   detail::vector_store<data_type, Alloc> win_args; ///< Reused for window function arguments
 };
 
@@ -1,21 +1,23 @@
 #pragma once
 
+#include <bit>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <numeric>
 #include <ratio>
 #include <type_traits>
 
 namespace opflow::chrono {
 namespace detail {
+// Delegates to std::gcd: libstdc++ and libc++ already implement the
+// division-free binary GCD (countr_zero + subtract, 128-bit included), so
+// the standard library version tracks any upstream improvements for free.
+// a, b >= 0.
 template <std::integral T>
 constexpr T gcd(T a, T b) noexcept {
-  while (b != 0) {
-    T t = b;
-    b = a % b;
-    a = t;
-  }
-  return a;
+  return std::gcd(a, b);
 }
 
 // Choose a wider intermediate type for mixed multiplications to mitigate overflow.
@@ -41,10 +43,11 @@ struct ratio {
 
   constexpr ratio(rep n = 1, rep d = 1) noexcept : num(n), denom(d) { normalize(); }
 
+  // std::ratio already stores num/den reduced with den > 0, so normalize()
+  // would be a no-op; trust the guarantee and skip the gcd
   template <auto Num, auto Denom>
-  constexpr ratio(std::ratio<Num, Denom>) noexcept : num(static_cast<rep>(Num)), denom(static_cast<rep>(Denom)) {
-    normalize();
-  }
+  constexpr ratio(std::ratio<Num, Denom> r) noexcept
+      : num(static_cast<rep>(decltype(r)::num)), denom(static_cast<rep>(decltype(r)::den)) {}
 
   constexpr ratio reduce() const noexcept { return *this; }
 
@@ -89,26 +92,62 @@ private:
     if (sec_per_tick == other.sec_per_tick) {
       return other.n;
     }
+    if constexpr (std::floating_point<rep>) {
+      // For a floating rep the gcd reduction buys nothing: the int32 cross
+      // products are exactly representable, so divide them once and convert
+      // with a single multiply in rep precision (no long double round trip).
+      // This also preserves fractional tick counts that the integer path
+      // below would truncate away.
+      rep const k = (static_cast<rep>(other.sec_per_tick.num) * static_cast<rep>(sec_per_tick.denom)) /
+                    (static_cast<rep>(other.sec_per_tick.denom) * static_cast<rep>(sec_per_tick.num));
+      return other.n * k;
+    }
     using wide = detail::widen_int_t<rep>;
     wide num = static_cast<wide>(other.sec_per_tick.num) * static_cast<wide>(sec_per_tick.denom);
     wide denom = static_cast<wide>(other.sec_per_tick.denom) * static_cast<wide>(sec_per_tick.num);
+#if defined(__GNUC__) || defined(__clang__)
+    // Common case: the unreduced product fits in wide. Truncated division
+    // gives the same result reduced or not, so gcd can be skipped entirely.
+    if constexpr (std::integral<wide>) {
+      wide prod;
+      if (!__builtin_mul_overflow(static_cast<wide>(other.n), num, &prod)) {
+        return static_cast<rep>(prod / denom);
+      }
+    }
+#endif
     auto g = detail::gcd(num < 0 ? -num : num, denom < 0 ? -denom : denom);
     if (g > 1) {
       num /= g;
       denom /= g;
     }
+    if (denom == 1) { // exact conversion, e.g. coarser -> finer built-in periods
+      return static_cast<rep>(static_cast<wide>(other.n) * num);
+    }
     wide scaled = static_cast<wide>(other.n) * num / denom; // truncation toward zero for integral rep
     return static_cast<rep>(scaled);
   }
 
+  // Cross-multiplied comparison value, widened so the product cannot
+  // overflow: |n| * |num| * |denom| needs at most 63 + 31 + 31 bits
+  static constexpr auto cross(const duration &a, const duration &b) noexcept {
+    if constexpr (std::integral<rep>) {
+      using wide = detail::widen_int_t<rep>;
+      return static_cast<wide>(a.n) * a.sec_per_tick.num * b.sec_per_tick.denom;
+    } else {
+      return a.n * a.sec_per_tick.num * b.sec_per_tick.denom;
+    }
+  }
+
 public:
   // Constructors
   constexpr duration() noexcept = default;
   constexpr explicit duration(rep const &n, period r = second) noexcept : n(n), sec_per_tick(r) {}
 
-  // Converting constructor from std::chrono::duration
+  // Converting constructor from std::chrono::duration. Passing the
+  // std::ratio through (rather than its raw num/den) hits the ratio
+  // constructor that trusts std::ratio's reduction and skips normalize()
   template <typename Period>
-  constexpr duration(const std::chrono::duration<rep, Period> &d) noexcept : sec_per_tick(Period::num, Period::den) {
+  constexpr duration(const std::chrono::duration<rep, Period> &d) noexcept : sec_per_tick(Period{}) {
     n = d.count();
   }
 
@@ -171,8 +210,7 @@ public:
     if (lhs.sec_per_tick == rhs.sec_per_tick) {
       return lhs.n == rhs.n;
     }
-    return lhs.n * lhs.sec_per_tick.num * rhs.sec_per_tick.denom ==
-           rhs.n * rhs.sec_per_tick.num * lhs.sec_per_tick.denom;
+    return cross(lhs, rhs) == cross(rhs, lhs);
   }
 
   friend constexpr bool operator!=(const duration &lhs, const duration &rhs) noexcept { return !(lhs == rhs); }
@@ -181,8 +219,7 @@ public:
     if (lhs.sec_per_tick == rhs.sec_per_tick) {
       return lhs.n < rhs.n;
     }
-    return lhs.n * lhs.sec_per_tick.num * rhs.sec_per_tick.denom <
-           rhs.n * rhs.sec_per_tick.num * lhs.sec_per_tick.denom;
+    return cross(lhs, rhs) < cross(rhs, lhs);
   }
 
   friend constexpr bool operator<=(const duration &lhs, const duration &rhs) noexcept { return !(rhs < lhs); }
@@ -346,70 +383,27 @@ struct high_resolution_clock {
   }
 };
 
-// Convenience duration type aliases with default periods
-class nanoseconds : public duration<int64_t> {
-public:
-  constexpr nanoseconds() : duration<int64_t>(0, nano) {}
-  constexpr explicit nanoseconds(int64_t count) : duration<int64_t>(count, nano) {}
-  constexpr nanoseconds(int64_t count, period p) : duration<int64_t>(count, p) {}
-  constexpr nanoseconds(const duration<int64_t> &d) : duration<int64_t>(d) {}
-};
-
-class microseconds : public duration<int64_t> {
+// Convenience duration types with default periods: one template binding a
+// default period constant, instantiated per alias — each name stays a
+// distinct type like the former hand-written classes, with the constructor
+// set defined once
+template <period_type DefaultPeriod>
+class fixed_duration : public duration<int64_t> {
 public:
-  constexpr microseconds() : duration<int64_t>(0, micro) {}
-  constexpr explicit microseconds(int64_t count) : duration<int64_t>(count, micro) {}
-  constexpr microseconds(int64_t count, period p) : duration<int64_t>(count, p) {}
-  constexpr microseconds(const duration<int64_t> &d) : duration<int64_t>(d) {}
+  constexpr fixed_duration() : duration<int64_t>(0, DefaultPeriod) {}
+  constexpr explicit fixed_duration(int64_t count) : duration<int64_t>(count, DefaultPeriod) {}
+  constexpr fixed_duration(int64_t count, period p) : duration<int64_t>(count, p) {}
+  constexpr fixed_duration(const duration<int64_t> &d) : duration<int64_t>(d) {}
 };
 
-class milliseconds : public duration<int64_t> {
-public:
-  constexpr milliseconds() : duration<int64_t>(0, milli) {}
-  constexpr explicit milliseconds(int64_t count) : duration<int64_t>(count, milli) {}
-  constexpr milliseconds(int64_t count, period p) : duration<int64_t>(count, p) {}
-  constexpr milliseconds(const duration<int64_t> &d) : duration<int64_t>(d) {}
-};
-
-class seconds : public duration<int64_t> {
-public:
-  constexpr seconds() : duration<int64_t>(0, second) {}
-  constexpr explicit seconds(int64_t count) : duration<int64_t>(count, second) {}
-  constexpr seconds(int64_t count, period p) : duration<int64_t>(count, p) {}
-  constexpr seconds(const duration<int64_t> &d) : duration<int64_t>(d) {}
-};
-
-class minutes : public duration<int64_t> {
-public:
-  constexpr minutes() : duration<int64_t>(0, minute) {}
-  constexpr explicit minutes(int64_t count) : duration<int64_t>(count, minute) {}
-  constexpr minutes(int64_t count, period p) : duration<int64_t>(count, p) {}
-  constexpr minutes(const duration<int64_t> &d) : duration<int64_t>(d) {}
-};
-
-class hours : public duration<int64_t> {
-public:
-  constexpr hours() : duration<int64_t>(0, hour) {}
-  constexpr explicit hours(int64_t count) : duration<int64_t>(count, hour) {}
-  constexpr hours(int64_t count, period p) : duration<int64_t>(count, p) {}
-  constexpr hours(const duration<int64_t> &d) : duration<int64_t>(d) {}
-};
-
-class days : public duration<int64_t> {
-public:
-  constexpr days() : duration<int64_t>(0, day) {}
-  constexpr explicit days(int64_t count) : duration<int64_t>(count, day) {}
-  constexpr days(int64_t count, period p) : duration<int64_t>(count, p) {}
-  constexpr days(const duration<int64_t> &d) : duration<int64_t>(d) {}
-};
-
-class weeks : public duration<int64_t> {
-public:
-  constexpr weeks() : duration<int64_t>(0, week) {}
-  constexpr explicit weeks(int64_t count) : duration<int64_t>(count, week) {}
-  constexpr weeks(int64_t count, period p) : duration<int64_t>(count, p) {}
-  constexpr weeks(const duration<int64_t> &d) : duration<int64_t>(d) {}
-};
+using nanoseconds = fixed_duration<nano>;
+using microseconds = fixed_duration<micro>;
+using milliseconds = fixed_duration<milli>;
+using seconds = fixed_duration<second>;
+using minutes = fixed_duration<minute>;
+using hours = fixed_duration<hour>;
+using days = fixed_duration<day>;
+using weeks = fixed_duration<week>;
 
 // R POSIXct, Python datetime compatible (seconds since epoch, double rep)
 class POSIXct : public duration<double> {
@@ -442,10 +436,10 @@ template <typename ToDuration, typename Rep>
 constexpr ToDuration duration_cast(const duration<Rep> &d) noexcept {
   using to_rep = typename ToDuration::rep;
 
-  // Get the default period for the target duration type
-  // Create a default instance and use its period
-  ToDuration default_target{};
-  auto target_period = default_target.get_period();
+  // Default period of the target duration type; the default constructors of
+  // the convenience aliases are constexpr, so this folds to a constant and
+  // never materializes a temporary at runtime
+  constexpr auto target_period = ToDuration{}.get_period();
 
   // Convert to target period
   auto src_period = d.get_period();
@@ -453,22 +447,90 @@ constexpr ToDuration duration_cast(const duration<Rep> &d) noexcept {
     return ToDuration(d.count(), target_period);
   }
 
+  if constexpr (std::floating_point<to_rep>) {
+    // Floating target: the int32 cross products are exactly representable in
+    // to_rep, so one division yields the scale factor and the cast is a
+    // single multiply — no gcd and no long double round trip.
+    to_rep const k = (static_cast<to_rep>(src_period.num) * static_cast<to_rep>(target_period.denom)) /
+                     (static_cast<to_rep>(src_period.denom) * static_cast<to_rep>(target_period.num));
+    return ToDuration(static_cast<to_rep>(d.count()) * k, target_period);
+  }
+
   // Prevent overflow in the conversion calculation
   using wide = detail::widen_int_t<to_rep>;
   wide num = static_cast<wide>(src_period.num) * static_cast<wide>(target_period.denom);
   wide denom = static_cast<wide>(src_period.denom) * static_cast<wide>(target_period.num);
+#if defined(__GNUC__) || defined(__clang__)
+  // Common case: the unreduced product fits in wide. Truncated division
+  // gives the same result reduced or not, so gcd can be skipped entirely.
+  if constexpr (std::integral<to_rep> && std::integral<wide>) {
+    wide prod;
+    if (!__builtin_mul_overflow(static_cast<wide>(d.count()), num, &prod)) {
+      return ToDuration(static_cast<to_rep>(prod / denom), target_period);
+    }
+  }
+#endif
   auto g = detail::gcd(num < 0 ? -num : num, denom < 0 ? -denom : denom);
   if (g > 1) {
     num /= g;
     denom /= g;
   }
-  if constexpr (std::floating_point<to_rep>) {
-    return ToDuration(static_cast<to_rep>(static_cast<long double>(d.count()) * static_cast<long double>(num) /
-                                          static_cast<long double>(denom)),
-                      target_period);
-  } else {
-    wide converted = static_cast<wide>(d.count()) * num / denom;
-    return ToDuration(static_cast<to_rep>(converted), target_period);
+  if (denom == 1) { // exact conversion, e.g. coarser -> finer built-in periods
+    return ToDuration(static_cast<to_rep>(static_cast<wide>(d.count()) * num), target_period);
+  }
+  wide converted = static_cast<wide>(d.count()) * num / denom;
+  return ToDuration(static_cast<to_rep>(converted), target_period);
+}
+
+// Bulk tick conversion between two runtime periods.
+//
+// Converts n tick counts in one call with the period arithmetic hoisted out
+// of the loop: cross products are reduced once, so each element pays a single
+// widening multiply (plus one divide when the conversion is inexact), and the
+// exact-conversion loop is a plain mul-by-invariant the compiler vectorizes.
+// Per-element semantics match duration_cast (truncation toward zero).
+template <std::integral Rep>
+constexpr void convert_ticks(Rep const *src, Rep *dst, std::size_t n, period_type from, period_type to) noexcept {
+  if (from == to) {
+    for (std::size_t i = 0; i < n; ++i) {
+      dst[i] = src[i];
+    }
+    return;
+  }
+  using wide = detail::widen_int_t<Rep>;
+  wide num = static_cast<wide>(from.num) * static_cast<wide>(to.denom);
+  wide denom = static_cast<wide>(from.denom) * static_cast<wide>(to.num);
+  auto g = detail::gcd(num < 0 ? -num : num, denom < 0 ? -denom : denom);
+  if (g > 1) {
+    num /= g;
+    denom /= g;
+  }
+  if (denom == 1) { // exact conversion, e.g. coarser -> finer built-in periods
+    for (std::size_t i = 0; i < n; ++i) {
+      dst[i] = static_cast<Rep>(static_cast<wide>(src[i]) * num);
+    }
+    return;
+  }
+  for (std::size_t i = 0; i < n; ++i) {
+    dst[i] = static_cast<Rep>(static_cast<wide>(src[i]) * num / denom);
+  }
+}
+
+// Floating-point overload (e.g. POSIXct series): the scale factor is computed
+// once from the exactly-representable int32 cross products, so each element
+// pays a single multiply and the loop vectorizes.
+template <std::floating_point Rep>
+constexpr void convert_ticks(Rep const *src, Rep *dst, std::size_t n, period_type from, period_type to) noexcept {
+  if (from == to) {
+    for (std::size_t i = 0; i < n; ++i) {
+      dst[i] = src[i];
+    }
+    return;
+  }
+  Rep const k = (static_cast<Rep>(from.num) * static_cast<Rep>(to.denom)) /
+                (static_cast<Rep>(from.denom) * static_cast<Rep>(to.num));
+  for (std::size_t i = 0; i < n; ++i) {
+    dst[i] = src[i] * k;
   }
 }
 
@@ -482,27 +544,37 @@ constexpr ToTimePoint time_point_cast(const time_point<Clock> &tp) noexcept {
 // Common duration operations
 template <typename Rep>
 constexpr duration<Rep> abs(const duration<Rep> &d) noexcept {
-  return d >= duration<Rep>::zero() ? d : -d;
+  using wide = detail::widen_int_t<Rep>;
+  if constexpr (std::signed_integral<Rep> && sizeof(Rep) >= sizeof(int) && std::integral<wide>) {
+    // Branchless conditional negate: the sign of the value is the sign of
+    // n * num (denom is kept positive). The product is formed in the widened
+    // type, mirroring cross(): |n| * |num| needs up to 63 + 31 bits, so a
+    // Rep-width multiply could overflow for coarse periods. Sub-int reps are
+    // excluded because integer promotion would make the shift operate on the
+    // promoted width rather than Rep's; unsigned reps are already
+    // non-negative and take the compare-select, which folds to the identity.
+    wide const prod = static_cast<wide>(d.count()) * static_cast<wide>(d.get_period().num);
+    Rep const s = static_cast<Rep>(prod >> (sizeof(wide) * 8 - 1));
+    return duration<Rep>(static_cast<Rep>((d.count() ^ s) - s), d.get_period());
+  } else {
+    return d >= duration<Rep>::zero() ? d : -d;
+  }
 }
 
 // Floor operation for durations
 template <typename ToDuration, typename Rep>
 constexpr ToDuration floor(const duration<Rep> &d) noexcept {
+  // Truncation rounded toward zero; step down when that landed above d.
+  // The adjustment is arithmetic rather than a branch on the comparison.
   auto result = duration_cast<ToDuration>(d);
-  if (result > d) {
-    return ToDuration(result.count() - 1);
-  }
-  return result;
+  return ToDuration(result.count() - static_cast<typename ToDuration::rep>(result > d));
 }
 
 // Ceiling operation for durations
 template <typename ToDuration, typename Rep>
 constexpr ToDuration ceil(const duration<Rep> &d) noexcept {
   auto result = duration_cast<ToDuration>(d);
-  if (result < d) {
-    return ToDuration(result.count() + 1);
-  }
-  return result;
+  return ToDuration(result.count() + static_cast<typename ToDuration::rep>(result < d));
 }
 
 // Round operation for durations
@@ -512,14 +584,11 @@ constexpr ToDuration round(const duration<Rep> &d) noexcept {
   auto diff1 = abs(d - result);
   auto diff2 = abs(d - (result + ToDuration(1)));
 
-  if (diff1 < diff2) {
-    return result;
-  } else if (diff1 > diff2) {
-    return ToDuration(result.count() + 1);
-  } else {
-    // Tie-breaking: round to even
-    return (result.count() % 2 == 0) ? result : ToDuration(result.count() + 1);
-  }
+  // Bump when the upper neighbour is strictly closer, or on a tie when the
+  // truncated count is odd (round half to even); bitwise combine keeps the
+  // select free of short-circuit branches
+  bool const bump = (diff2 < diff1) | (!(diff1 < diff2) & (result.count() % 2 != 0));
+  return ToDuration(result.count() + static_cast<typename ToDuration::rep>(bump));
 }
 
 } // namespace opflow::chrono
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <vector>
+
+#include "chrono.hpp"
+
+namespace opflow::chrono {
+/**
+ * @brief SoA storage for a series of durations sharing one period
+ *
+ * An array of duration objects pays 16 bytes per element even when every
+ * element shares the same period. duration_series keeps a single period for
+ * the whole series and a flat vector of tick counts, halving the footprint,
+ * and the reductions below run over a contiguous Rep stream with no
+ * per-element period to consult — a plain loop the compiler vectorizes.
+ */
+template <typename Rep>
+class duration_series {
+public:
+  using rep = Rep;
+  using value_type = duration<Rep>;
+
+  explicit duration_series(period_type p = second) noexcept : ticks(), sec_per_tick(p) {}
+
+  period_type get_period() const noexcept { return sec_per_tick; }
+
+  size_t size() const noexcept { return ticks.size(); }
+  bool empty() const noexcept { return ticks.empty(); }
+  void reserve(size_t n) { ticks.reserve(n); }
+  void clear() noexcept { ticks.clear(); }
+
+  rep const *data() const noexcept { return ticks.data(); }
+
+  /// Append a raw tick count, taken to be in the series period
+  void push_back(rep count) { ticks.push_back(count); }
+
+  /// Append a duration, re-expressed in the series period (truncating)
+  void push_back(value_type const &d) {
+    value_type anchor(rep{}, sec_per_tick);
+    anchor += d;
+    ticks.push_back(anchor.count());
+  }
+
+  value_type operator[](size_t i) const noexcept { return value_type(ticks[i], sec_per_tick); }
+
+  value_type sum() const noexcept {
+    rep s{};
+    for (rep t : ticks) {
+      s += t;
+    }
+    return value_type(s, sec_per_tick);
+  }
+
+  /// Smallest element; series must be non-empty
+  value_type min() const noexcept {
+    assert(!ticks.empty() && "[BUG] min() on empty duration_series.");
+    return value_type(*std::min_element(ticks.begin(), ticks.end()), sec_per_tick);
+  }
+
+  /// Largest element; series must be non-empty
+  value_type max() const noexcept {
+    assert(!ticks.empty() && "[BUG] max() on empty duration_series.");
+    return value_type(*std::max_element(ticks.begin(), ticks.end()), sec_per_tick);
+  }
+
+  /// Whole-series period conversion in one bulk pass (see convert_ticks)
+  duration_series converted(period_type to) const
+    requires(std::integral<Rep> || std::floating_point<Rep>)
+  {
+    duration_series out(to);
+    out.ticks.resize(ticks.size());
+    convert_ticks(ticks.data(), out.ticks.data(), ticks.size(), sec_per_tick, to);
+    return out;
+  }
+
+private:
+  std::vector<rep> ticks;
+  period_type sec_per_tick;
+};
+} // namespace opflow::chrono
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <bit>
 #include <limits>
+#include <random>
 #include <string>
 #include <string_view>
 #include <utility>
@@ -99,12 +101,29 @@ constexpr bool very_small(T v) {
 
 template <size_t N = 6, std::uniform_random_bit_generator G>
 std::string random_string(G &gen, std::string_view prefix = "") {
-  std::uniform_int_distribution<size_t> dist(0, sizeof(detail::name_chars) - 2); // Exclude null terminator
+  // The alphabet has 64 characters, so each one needs exactly 6 unbiased
+  // bits: slice one generator draw into 6-bit table indices instead of
+  // paying uniform_int_distribution's rejection loop and modulo per
+  // character. (Engines whose range is not a power of two leave a bias
+  // below 1e-7 in the slices — irrelevant for ID generation.)
+  static_assert(std::has_single_bit(sizeof(detail::name_chars) - 1), "Alphabet size must be a power of two");
+  constexpr size_t char_bits = std::countr_zero(sizeof(detail::name_chars) - 1);
+  constexpr size_t char_mask = sizeof(detail::name_chars) - 2;
+  constexpr size_t chars_per_draw = std::bit_width(G::max() - G::min()) / char_bits;
+  static_assert(chars_per_draw > 0, "Generator must yield at least 6 random bits per draw");
 
   std::string str(prefix.size() + N, '\0');
   std::copy(prefix.begin(), prefix.end(), str.begin());
+  auto draw = gen() - G::min();
+  size_t left = chars_per_draw;
   for (size_t i = prefix.size(); i < str.size(); ++i) {
-    str[i] = detail::name_chars[dist(gen)];
+    if (left == 0) {
+      draw = gen() - G::min();
+      left = chars_per_draw;
+    }
+    str[i] = detail::name_chars[draw & char_mask];
+    draw >>= char_bits;
+    --left;
   }
   return str;
 }
@@ -13,7 +13,9 @@
 namespace opflow::detail {
 template <dag_node_base T, typename Alloc = std::allocator<T>>
 struct agg_store {
-  using byte_alloc = rebind_alloc<Alloc, std::byte>;
+  // default_init: the arena is carved up by placement-new immediately, so
+  // resize() must not spend a memset zeroing multi-KB backing storage
+  using byte_alloc = default_init_alloc<std::byte, rebind_alloc<Alloc, std::byte>>;
   std::vector<std::byte, byte_alloc> arena_storage;
   fixed_buffer_resource arena;
 
@@ -30,8 +32,8 @@ public:
 
   template <typename G>
   agg_store(G const &g, size_t n_group = 1, Alloc alloc = Alloc{})
-      : arena_storage(alloc), arena(nullptr, 0), n_grp(n_group), n_nodes(g.size()), win_ptrs(), node_ptrs(),
-        record_size(), record_offset(alloc), input_column(alloc), win_column(alloc) {
+      : arena_storage(alloc), arena(nullptr, 0), n_grp(n_group), n_nodes(g.size()), win_ptrs(&arena),
+        node_ptrs(&arena), record_size(), record_offset(&arena), input_column(&arena), win_column(&arena) {
     if (n_group == 0) {
       throw std::invalid_argument("Number of groups must be greater than 0.");
     }
@@ -75,9 +77,13 @@ private:
   template <typename G>
   void init_arena(G const &graph) {
     // Memory layout:
-    // | ptr win | ..... | ptr node | ..... | PADDING | node grp | PADDING | ... | node grp | ... |
+    // | ptr win | ..... | ptr node | ..... | PADDING | node grp | PADDING | ... | node grp | ... | u32 tables |
     // | <---CONCURRENT READONLY ACCESS---> |
     //
+    // u32 tables = record_offset | input_column | win_column: written once in
+    // the constructor, read-only afterwards; placing them in the same arena
+    // keeps all per-graph lookup state within one mapping for TLB locality.
+    //
     // ptr win = | ptr win 0 | ptr win 1 | ... | ptr win n |
     // ptr node = | ptr grp 0 node 0 | ptr grp 0 node 1 | ... | ptr grp 0 node n | ... | ptr grp m node n |
     //
@@ -107,7 +113,22 @@ private:
       node_size += aligned_size(node->clone_size(), align);
     }
     size_t node_grp_size = aligned_size(win_size + node_size, max_align);
-    total += node_grp_size * n_grp;
+
+    // Set coloring: when the group block is a multiple of the L1 way stride,
+    // the same node in every group maps to one cache set and round-robin
+    // group evaluation thrashes it. Stagger the groups by one max_align.
+    grp_pad = (node_grp_size % l1_way_stride == 0) ? max_align : 0;
+    total += (node_grp_size + grp_pad) * n_grp;
+
+    // read-only lookup tables, filled by the constructor after copy_nodes
+    size_t n_edges = 0;
+    for (size_t i = 0; i < n_nodes; ++i) {
+      n_edges += graph.input_column(i).size();
+    }
+    total += aligned_size(n_nodes * sizeof(u32), cacheline_size);     // record_offset
+    total += aligned_size(n_nodes * 2 * sizeof(u32), cacheline_size); // input_column index
+    total += aligned_size(n_edges * sizeof(u32), cacheline_size);     // input_column flat
+    total += aligned_size(graph.window_input_column().size() * sizeof(u32), cacheline_size); // win_column
 
     // add extra max_align to ensure space fits
     total += max_align;
@@ -116,11 +137,11 @@ private:
     arena_storage.resize(total);
     arena = fixed_buffer_resource(arena_storage.data(), arena_storage.size());
 
-    // consolidate memory layout
-    win_ptrs = std::pmr::vector<window_type>(&arena);
+    // Consolidate memory layout. The vectors are bound to &arena in the
+    // member init list: pmr allocators do not propagate on assignment, so
+    // assigning a fresh vector here would silently keep the default heap
+    // resource and leave the reserved arena region unused.
     win_ptrs.reserve(n_grp);
-
-    node_ptrs = std::pmr::vector<node_type>(&arena);
     node_ptrs.reserve(n_grp * n_nodes);
   }
 
@@ -140,21 +161,25 @@ private:
         mem = arena.allocate(node->clone_size(), node->clone_align());
         node_ptrs.emplace_back(node->clone_at(mem));
       }
+      if (grp_pad) {
+        arena.allocate(grp_pad, 1); // coloring filler, see init_arena
+      }
     }
   }
 
   size_t const n_grp;
   size_t const n_nodes;
+  size_t grp_pad = 0; ///< per-group coloring pad, see init_arena
 
   std::pmr::vector<window_type> win_ptrs; ///< windows, size = n_grp
   std::pmr::vector<node_type> node_ptrs;  ///< nodes, size = n_grp * n_nodes
 
-  using u32_alloc = rebind_alloc<Alloc, u32>;
+  using u32_alloc = std::pmr::polymorphic_allocator<u32>;
 
 public:
   u32 record_size;
-  std::vector<u32> record_offset;                   // i-th node -> offset in record
+  std::pmr::vector<u32> record_offset;              // i-th node -> offset in record
   flat_multivect<u32, u32, u32_alloc> input_column; // i-th node -> [input column]
-  std::vector<u32> win_column;                      // [window column]
+  std::pmr::vector<u32> win_column;                 // [window column]
 };
 } // namespace opflow::detail
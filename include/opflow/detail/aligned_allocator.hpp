@@ -1,5 +1,8 @@
 #pragma once
 
+#include <memory>
+#include <new>
+
 #include "utils.hpp"
 
 namespace opflow::detail {
@@ -27,16 +30,19 @@ struct aligned_allocator {
     if (n == 0)
       return nullptr;
 
-    // std::aligned_alloc requires size to be a multiple of alignment
-    size_type aligned_bytes = aligned_size(n * sizeof(T), Alignment);
-    return static_cast<pointer>(std::aligned_alloc(Alignment, aligned_bytes));
+    // aligned operator new has no size-multiple-of-alignment requirement
+    // (no padding needed) and throws bad_alloc instead of returning null;
+    // assume_aligned hands the alignment guarantee to the optimizer so
+    // loops over the storage can use aligned vector loads
+    void *ptr = ::operator new(n * sizeof(T), std::align_val_t{Alignment});
+    return std::assume_aligned<Alignment>(static_cast<pointer>(ptr));
   }
 
   void deallocate(pointer ptr, size_type) noexcept {
     if (ptr == nullptr)
       return;
 
-    std::free(ptr);
+    ::operator delete(ptr, std::align_val_t{Alignment});
   }
 
   size_type max_size() const noexcept { return (std::numeric_limits<size_type>::max)() / sizeof(T); }
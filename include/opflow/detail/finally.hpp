@@ -6,12 +6,17 @@
 
 namespace opflow::detail {
 template <typename Fn>
-class finally {
+class [[nodiscard]] finally {
 public:
   finally(Fn f) noexcept : fn(std::move(f)), active(true) {}
-  finally(finally &&other) noexcept : fn(std::move(other.fn)), active(other.active) { other.active = false; }
+  finally(finally &&other) noexcept : fn(std::move(other.fn)), active(std::exchange(other.active, false)) {}
+
+  finally(finally const &) = delete;
+  finally &operator=(finally const &) = delete;
+  finally &operator=(finally &&) = delete;
+
   ~finally() {
-    if (active)
+    if (active) [[likely]]
       fn();
   }
 
@@ -5,7 +5,9 @@
 #include "utils.hpp"
 
 namespace opflow::detail {
-class fixed_buffer_resource : public std::pmr::memory_resource {
+// final: allocate() through a concretely-typed arena then devirtualizes —
+// the compiler can prove do_allocate's target and inline the bump path
+class fixed_buffer_resource final : public std::pmr::memory_resource {
   std::byte *buffer_;
   std::byte *curr_;
   std::byte *end_;
@@ -16,13 +18,17 @@ public:
 
 protected:
   void *do_allocate(std::size_t bytes, std::size_t alignment) override {
+    // Branchless pad computation, and the capacity check compares sizes
+    // rather than advancing a pointer first — no pointer arithmetic past
+    // the buffer end on the failure path.
     auto uptr = reinterpret_cast<uintptr_t>(curr_);
-    auto aligned = reinterpret_cast<std::byte *>(aligned_size(uptr, alignment));
-    auto new_curr = aligned + bytes;
-    if (new_curr > end_) {
+    std::size_t const pad = (-uptr) & (alignment - 1);
+    std::size_t const avail = static_cast<std::size_t>(end_ - curr_);
+    if (pad > avail || bytes > avail - pad) {
       throw std::bad_alloc(); // Out of memory
     }
-    curr_ = new_curr;
+    std::byte *aligned = curr_ + pad;
+    curr_ = aligned + bytes;
     return aligned;
   }
 
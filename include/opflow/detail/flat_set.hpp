@@ -1,7 +1,17 @@
 #pragma once
 
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <concepts>
+#include <numeric>
+#include <type_traits>
 #include <vector>
 
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 #include "iterator.hpp"
 
 namespace opflow::detail {
@@ -79,6 +89,46 @@ public:
   size_type insert(T const &val) { return emplace(val); }
   size_type insert(T &&val) { return emplace(std::move(val)); }
 
+  /**
+   * @brief Inserts a range of elements, keeping the first occurrence of each value.
+   *
+   * Equivalent to calling insert() per element but runs in O(n log n): duplicates
+   * are found via a stable sort over (value, position) instead of a linear probe
+   * per insertion. Insertion order of surviving elements is preserved.
+   *
+   * @param first, last Range of elements to insert
+   * @return number of elements actually inserted
+   */
+  template <typename InputIt>
+    requires std::totally_ordered<T>
+  size_type bulk_insert(InputIt first, InputIt last) {
+    size_type const old_size = data.size();
+    data.insert(data.end(), first, last);
+    if (data.size() == old_size)
+      return 0;
+
+    std::vector<size_type> order(data.size());
+    std::iota(order.begin(), order.end(), size_type{});
+    std::stable_sort(order.begin(), order.end(), [&](size_type a, size_type b) { return data[a] < data[b]; });
+
+    std::vector<bool> dup(data.size(), false);
+    for (size_type i = 1; i < order.size(); ++i) {
+      if (data[order[i]] == data[order[i - 1]])
+        dup[order[i]] = true;
+    }
+
+    size_type w = 0;
+    for (size_type r = 0; r < data.size(); ++r) {
+      if (!dup[r]) {
+        if (w != r)
+          data[w] = std::move(data[r]);
+        ++w;
+      }
+    }
+    data.erase(data.begin() + static_cast<difference_type>(w), data.end());
+    return data.size() - old_size;
+  }
+
   const_iterator erase(T const &val) {
     if (auto it = std::ranges::find(data, val); it != data.end()) {
       auto dist = std::ranges::distance(data.begin(), it);
@@ -117,13 +167,9 @@ public:
 
   // lookup
 
-  const_iterator find(T const &val) const {
-    auto it = std::ranges::find(data, val);
-    auto dist = std::ranges::distance(data.begin(), it);
-    return const_iterator(this, static_cast<size_type>(dist));
-  }
+  const_iterator find(T const &val) const { return const_iterator(this, find_index(val)); }
 
-  bool contains(T const &val) const { return std::ranges::find(data, val) != std::ranges::end(data); }
+  bool contains(T const &val) const { return find_index(val) != data.size(); }
 
   size_type count(T const &val) const { return std::ranges::count(data, val); }
 
@@ -139,6 +185,57 @@ public:
   }
 
 private:
+#if defined(__AVX2__)
+  /// AVX2 scan applies when keys are vector-backed integrals of SIMD-friendly width
+  static constexpr bool simd_scan = std::is_integral_v<T> && (sizeof(T) == 4 || sizeof(T) == 8) &&
+                                    std::is_same_v<Container, std::vector<T>>;
+#endif
+
+  /**
+   * @brief Index of the first element equal to val, or size() if absent.
+   *
+   * Linear scan as the container is unsorted; for integral keys an AVX2 path
+   * compares 4 or 8 keys per iteration and resolves the hit via movemask,
+   * which wins over per-element compare+branch at the small sizes flat_set
+   * is used for.
+   */
+  size_type find_index(T const &val) const {
+#if defined(__AVX2__)
+    if constexpr (simd_scan) {
+      size_type const n = data.size();
+      T const *p = data.data();
+      size_type i = 0;
+      if constexpr (sizeof(T) == 8) {
+        __m256i const needle = _mm256_set1_epi64x(static_cast<long long>(val));
+        for (; i + 4 <= n; i += 4) {
+          __m256i v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+          int mask = _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(v, needle)));
+          if (mask)
+            return i + static_cast<size_type>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+      } else {
+        __m256i const needle = _mm256_set1_epi32(static_cast<int>(val));
+        for (; i + 8 <= n; i += 8) {
+          __m256i v = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+          int mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(v, needle)));
+          if (mask)
+            return i + static_cast<size_type>(std::countr_zero(static_cast<unsigned>(mask)));
+        }
+      }
+      for (; i < n; ++i) {
+        if (p[i] == val)
+          return i;
+      }
+      return n;
+    } else {
+#endif
+      auto it = std::ranges::find(data, val);
+      return static_cast<size_type>(std::ranges::distance(data.begin(), it));
+#if defined(__AVX2__)
+    }
+#endif
+  }
+
   container_type data; ///< Underlying storage for the set
 };
 
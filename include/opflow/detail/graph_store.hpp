@@ -1,6 +1,7 @@
 #pragma once
 
-#include <queue>
+#include <array>
+#include <unordered_map>
 
 #include "../common.hpp"
 #include "fixed_buffer_resource.hpp"
@@ -48,7 +49,9 @@ graph TD
 
 template <typename T, typename U, typename Alloc = std::allocator<T>>
 class graph_store {
-  using byte_alloc = rebind_alloc<Alloc, std::byte>;
+  // default_init: the arena is carved up by placement-new immediately, so
+  // resize() must not spend a memset zeroing multi-KB backing storage
+  using byte_alloc = default_init_alloc<std::byte, rebind_alloc<Alloc, std::byte>>;
   std::vector<std::byte, byte_alloc> arena_storage;
   fixed_buffer_resource arena;
 
@@ -67,10 +70,10 @@ public:
       : // arena
         arena_storage(alloc), arena(nullptr, 0),
         // data
-        n_grp(n_group), n_nodes(g.size()), win_ptrs(), param_ptrs(), node_ptrs(),
+        n_grp(n_group), n_nodes(g.size()), win_ptrs(&arena), param_ptrs(&arena), node_ptrs(&arena),
         // topo
-        record_size(), param_size(), record_offset(alloc), input_offset(alloc), output_offset(alloc), param_node(alloc),
-        param_port(alloc) {
+        record_size(), param_size(), record_offset(&arena), input_offset(&arena), output_offset(&arena),
+        param_node(&arena), param_port(&arena) {
     if (n_grp == 0) {
       throw std::invalid_argument("Number of groups must be greater than 0.");
     }
@@ -95,50 +98,106 @@ public:
 
     using key_type = typename G::key_type;
     using hash_type = typename G::key_hash;
-    using lookup_type = std::unordered_map<key_type, u32, hash_type, std::equal_to<>>;
-    std::vector<key_type> keys{};         // sorted node keys
-    std::vector<shared_node_ptr> nodes{}; // sorted node instances
-    lookup_type idx{};                    // node key -> sorted index
-
-    lookup_type in_degree{};
-    std::queue<key_type> ready{};
+    // All sort-time scratch (map nodes, buckets, and the vectors below)
+    // comes from one stack-seeded monotonic pool: it dies with the
+    // constructor, so bump allocation with a single bulk release fits and
+    // small graphs never touch the heap.
+    std::array<std::byte, 4096> scratch;
+    std::pmr::monotonic_buffer_resource pool(scratch.data(), scratch.size());
+    using lookup_type = std::pmr::unordered_map<key_type, u32, hash_type, std::equal_to<>>;
+    // keys holds pointers into g's node-based maps instead of key copies:
+    // key_type may be an owning handle (shared_ptr for graph_node, string
+    // for graph_named) and copying it per queue hop pays a refcount bump or
+    // a string copy. The graph outlives construction and unordered
+    // containers never move their elements, so the pointers stay valid.
+    std::pmr::vector<key_type const *> keys{&pool}; // sorted node keys
+    std::pmr::vector<shared_node_ptr> nodes{&pool}; // sorted node instances
+
+    // in_degree doubles as the key -> sorted index map: once a node is
+    // popped its counter has decayed to 0 and is never touched again, so
+    // the slot is free to hold the final position. Saves a second hash
+    // table and n_nodes inserts.
+    lookup_type in_degree{&pool};
 
     keys.reserve(n_nodes);
     nodes.reserve(n_nodes);
-    idx.reserve(n_nodes);
-
     in_degree.reserve(n_nodes);
     for (auto const &[node, preds] : g.pred()) {
       auto n_pred = preds.size();
       in_degree.emplace(node, n_pred);
       if (n_pred == 0) {
-        ready.push(node);
+        keys.push_back(&node);
       }
     }
 
-    while (!ready.empty()) {
-      auto current = std::move(ready.front());
-      ready.pop();
-      keys.push_back(current);
-
-      // update successors
+    // keys doubles as the FIFO: every node enters it at most once, so
+    // scanning while appending newly-ready successors pops in queue order
+    // without std::deque's block allocations. keys is reserved to n_nodes
+    // above, so no reallocation occurs mid-scan. Node fetch and the index
+    // assignment are fused into the pop: once current is popped its counter
+    // has decayed to zero and no later pop decrements it, so the slot can
+    // take the sorted position right away instead of in a second pass.
+    for (size_t qi = 0; qi < keys.size(); ++qi) {
+      key_type const &current = *keys[qi];
+      nodes.push_back(std::static_pointer_cast<node_type>(g.node(current)));
       auto succ_it = g.succ().find(current);
       for (auto const &succ : succ_it->second) {
         if (--in_degree[succ] == 0) {
-          ready.push(succ);
+          keys.push_back(&succ);
         }
       }
+      in_degree[current] = static_cast<u32>(qi);
     }
 
     if (keys.size() != n_nodes) {
       throw std::runtime_error("Cyclic graph detected.");
     }
 
-    for (u32 i = 0; i < keys.size(); ++i) {
-      idx[keys[i]] = i;
-      nodes.push_back(std::static_pointer_cast<node_type>(g.node(keys[i])));
+    // Cache the clone geometry: clone_size/clone_align are virtual and do
+    // not change per group, yet copy_data would otherwise replay both
+    // calls for every node in every group.
+    std::pmr::vector<u32> clone_sizes(n_nodes, &pool);
+    std::pmr::vector<u32> clone_aligns(n_nodes, &pool);
+    for (size_t i = 0; i < n_nodes; ++i) {
+      clone_sizes[i] = static_cast<u32>(nodes[i]->clone_size());
+      clone_aligns[i] = static_cast<u32>(nodes[i]->clone_align());
+    }
+
+    // Budget the read-only lookup tables up front: they are arena-backed
+    // (bound to &arena in the member init list), so the arena must be sized
+    // and live before any of them allocates.
+    // whether aux exists is a property of the instantiation: the ctor threw
+    // earlier if aux_type is non-void and the graph had no aux node, so the
+    // runtime aux checks below reduce to compile-time branches
+    size_t num_edges = 0;
+    if constexpr (!std::is_void_v<aux_type>) {
+      num_edges = g.aux_args().size();
+    }
+    auto const &g_args = g.args();
+    for (auto const &[_, args] : g_args) {
+      num_edges += args.size();
+    }
+
+    size_t n_supp = 0;
+    size_t supp_edges = 0;
+    if (supp) {
+      n_supp = g.supp_link().size();
+      for (auto const &[_, ports] : g.supp_link()) {
+        supp_edges += ports.size();
+      }
     }
 
+    size_t table_bytes = 0;
+    table_bytes += aligned_size(n_nodes * sizeof(u32), cacheline_size);           // record_offset
+    table_bytes += aligned_size(n_nodes * 2 * sizeof(u32), cacheline_size);       // input_offset index
+    table_bytes += aligned_size(num_edges * sizeof(u32), cacheline_size);         // input_offset flat
+    table_bytes += aligned_size(g.output().size() * sizeof(u32), cacheline_size); // output_offset
+    table_bytes += aligned_size(n_supp * 3 * sizeof(u32), cacheline_size);        // param_node + param_port index
+    table_bytes += aligned_size(supp_edges * sizeof(u32), cacheline_size);        // param_port flat
+
+    std::pmr::vector<size_t> grp_offset{&pool}; // within-group byte offset of each clone
+    init_arena(aux, supp, table_bytes, clone_sizes, clone_aligns, grp_offset);
+
     record_size = 0;
     record_offset.reserve(n_nodes);
     for (size_t i = 0; i < n_nodes; ++i) {
@@ -146,38 +205,30 @@ public:
       record_size += nodes[i]->num_outputs();
     }
 
-    auto num_edges = aux ? g.aux_args().size() : 0;
-    auto const &g_args = g.args();
-    for (auto const &[_, args] : g_args) {
-      num_edges += args.size();
-    }
     input_offset.reserve(n_nodes, num_edges);
 
-    std::vector<u32> arg_offset{};
-    if (aux) {
+    // resolve edges through a transform view so push_back writes straight
+    // into the flat storage — no per-node scratch vector in between
+    auto to_offset = [&](auto const &arg) {
+      auto const &[key, port] = arg;
+      return record_offset[in_degree[key]] + port;
+    };
+    if constexpr (!std::is_void_v<aux_type>) {
       // when aux exists, we steal slot 0 for aux args
       input_offset.push_back(g.aux_args());
     } else {
       // aux does not exist, put empty vector at slot 0 (root, never used)
-      input_offset.push_back(arg_offset);
+      input_offset.push_back(std::span<u32 const>{});
     }
     for (size_t i = 1; i < n_nodes; ++i) {
-      arg_offset.clear();
-      for (auto const &[key, port] : g_args.at(keys[i])) {
-        arg_offset.push_back(record_offset[idx[key]] + port);
-      }
-      input_offset.push_back(arg_offset);
+      input_offset.push_back(g_args.at(*keys[i]) | std::views::transform(to_offset));
     }
 
     if (supp) {
-      num_edges = 0;
-      for (auto const &[_, ports] : g.supp_link()) {
-        num_edges += ports.size();
-      }
-      param_node.reserve(g.supp_link().size());
-      param_port.reserve(g.supp_link().size(), num_edges);
+      param_node.reserve(n_supp);
+      param_port.reserve(n_supp, supp_edges);
       for (auto const &[key, ports] : g.supp_link()) {
-        param_node.push_back(idx[key]);
+        param_node.push_back(in_degree[key]);
         param_port.push_back(ports);
       }
       param_size = static_cast<u32>(supp->num_outputs());
@@ -185,11 +236,10 @@ public:
 
     output_offset.reserve(g.output().size());
     for (auto const &[key, port] : g.output()) {
-      output_offset.emplace_back(record_offset[idx[key]] + port);
+      output_offset.emplace_back(record_offset[in_degree[key]] + port);
     }
 
-    init_arena(nodes, aux, supp);
-    copy_data(nodes, aux, supp);
+    copy_data(nodes, aux, supp, grp_offset);
   }
 
   std::span<unique_node_ptr const> operator[](size_t igrp) const noexcept {
@@ -213,15 +263,24 @@ private:
     auto const &g_args = g.args();
     auto const &g_out = g.output();
 
+    auto supp = std::dynamic_pointer_cast<node_type>(g.supp_root());
+
+    // Single fused pass: root uniqueness, per-node RTTI check, arg-port and
+    // supp-port ranges all come from one g_preds traversal. Port checks call
+    // num_outputs() through the graph's own node type (the dag_node concept
+    // guarantees it), so no per-edge cast is required.
     bool root_found = false;
     for (auto const &[key, preds] : g_preds) {
+      auto node = g.node(key);
+      if (std::dynamic_pointer_cast<node_type>(node) == nullptr) {
+        throw std::invalid_argument("Incompatible node type in graph.");
+      }
       if (preds.empty()) {
         if (root_found) {
           throw std::invalid_argument("Multiple root nodes detected in graph.");
         }
-        auto root = std::dynamic_pointer_cast<node_type>(g.node(key));
         if (g.aux()) {
-          auto root_size = root->num_outputs();
+          auto root_size = node->num_outputs();
           for (auto port : g.aux_args()) {
             if (port >= root_size) {
               throw std::invalid_argument("Incompatible auxiliary node connections in graph.");
@@ -230,74 +289,90 @@ private:
         }
         root_found = true;
       }
-    }
-
-    auto supp = std::dynamic_pointer_cast<node_type>(g.supp_root());
-
-    for (auto const &[key, _] : g_preds) {
       for (auto const &[arg_key, arg_port] : g_args.at(key)) {
-        auto pred = std::dynamic_pointer_cast<node_type>(g.node(arg_key));
-        if (arg_port >= pred->num_outputs()) {
+        if (arg_port >= g.node(arg_key)->num_outputs()) {
           throw std::invalid_argument("Incompatible node connections in graph.");
         }
       }
-      if (supp && g.supp_link().contains(key)) {
-        for (auto port : g.supp_link().at(key)) {
-          if (port >= supp->num_outputs()) {
-            throw std::invalid_argument("Incompatible parameter node connections in graph.");
+      if (supp) {
+        // single find instead of contains + at hashing the key twice
+        if (auto it = g.supp_link().find(key); it != g.supp_link().end()) {
+          for (auto port : it->second) {
+            if (port >= supp->num_outputs()) {
+              throw std::invalid_argument("Incompatible parameter node connections in graph.");
+            }
           }
         }
       }
     }
 
     for (auto const &[key, port] : g_out) {
-      auto out = std::dynamic_pointer_cast<node_type>(g.node(key));
-      if (out == nullptr) {
+      // null-check stays: an output may name a key absent from the graph
+      auto out_node = g.node(key);
+      if (out_node == nullptr) {
         throw std::invalid_argument("Invalid output node.");
       }
-      if (port >= out->num_outputs()) {
+      if (port >= out_node->num_outputs()) {
         throw std::invalid_argument("Incompatible output node connections in graph.");
       }
     }
   }
 
-  void init_arena(std::vector<shared_node_ptr> const &nodes, shared_aux_ptr const &win, shared_node_ptr const &param) {
+  void init_arena(shared_aux_ptr const &win, shared_node_ptr const &param, size_t table_bytes,
+                  std::span<u32 const> clone_sizes, std::span<u32 const> clone_aligns,
+                  std::pmr::vector<size_t> &grp_offset) {
     // Memory layout:
-    // | win_ptrs | param_ptrs | node_ptrs | PADDING | node grp | PADDING | ... | node grp | PADDING |
+    // | win_ptrs | param_ptrs | node_ptrs | PADDING | node grp | PADDING | ... | node grp | ... | u32 tables |
     //
     // node grp = | win | param | node 0 | node 1 | ... | node n |
+    //
+    // u32 tables = record_offset | input_offset | output_offset | param
+    // tables: written once by the constructor, read-only afterwards;
+    // co-locating them with the ptrs keeps all dispatch-time metadata in
+    // one region (table_bytes is budgeted by the caller).
 
-    size_t arena_size = 0;
+    size_t arena_size = table_bytes;
 
     size_t win_ptrs_size = win ? heap_alloc_size(win_ptrs, n_grp) : 0;
     size_t param_ptrs_size = param ? heap_alloc_size(param_ptrs, n_grp) : 0;
     size_t node_ptrs_size = heap_alloc_size(node_ptrs, n_grp * n_nodes);
     arena_size += aligned_size(win_ptrs_size + param_ptrs_size + node_ptrs_size, cacheline_size);
 
+    // Lay out the group block once: record the within-group offset of every
+    // clone so copy_data can slice a single per-group allocation. Each
+    // offset is aligned to its entity and the block itself to max_align, so
+    // base + offset is always suitably aligned.
     size_t max_align = cacheline_size;
+    size_t off = 0;
+    grp_offset.reserve(n_nodes + 2);
 
-    size_t win_size = 0;
     if constexpr (!std::is_void_v<aux_type>)
       if (win) {
         auto align = win->clone_align();
         max_align = std::max(max_align, align);
-        win_size = aligned_size(win->clone_size(), align);
+        off = aligned_size(off, align);
+        grp_offset.push_back(off);
+        off += win->clone_size();
       }
 
-    size_t par_size = 0;
     if (param) {
       auto align = param->clone_align();
       max_align = std::max(max_align, align);
-      par_size = aligned_size(param->clone_size(), align);
+      off = aligned_size(off, align);
+      grp_offset.push_back(off);
+      off += param->clone_size();
     }
 
-    size_t node_size = 0;
-    for (auto const &node : nodes) {
-      auto align = node->clone_align();
+    for (size_t i = 0; i < n_nodes; ++i) {
+      size_t align = clone_aligns[i];
       max_align = std::max(max_align, align);
-      node_size += aligned_size(node->clone_size(), align);
+      off = aligned_size(off, align);
+      grp_offset.push_back(off);
+      off += clone_sizes[i];
     }
-    size_t node_grp_size = aligned_size(win_size + par_size + node_size, max_align);
+
+    node_grp_size = aligned_size(off, max_align);
+    grp_align = max_align;
 
     arena_size += n_grp * node_grp_size;
     // add extra max_align to ensure space fits
@@ -307,72 +382,59 @@ private:
     arena = fixed_buffer_resource{arena_storage.data(), arena_storage.size()};
 
     // consolidate ptrs at start of arena
+    // The vectors are bound to &arena in the member init list: pmr
+    // allocators do not propagate on assignment, so assigning a fresh
+    // vector here would silently keep the default heap resource and leave
+    // the reserved arena region unused.
     if (win) {
-      win_ptrs = std::pmr::vector<unique_aux_ptr>(&arena);
       win_ptrs.reserve(n_grp);
     }
     if (param) {
-      param_ptrs = std::pmr::vector<unique_node_ptr>(&arena);
       param_ptrs.reserve(n_grp);
     }
-    node_ptrs = std::pmr::vector<unique_node_ptr>(&arena);
     node_ptrs.reserve(n_grp * n_nodes);
   }
 
-  void copy_data(std::vector<shared_node_ptr> const &nodes, shared_aux_ptr const &win, shared_node_ptr const &param) {
-    void *mem;
-    bool grp_aligned;
+  void copy_data(std::pmr::vector<shared_node_ptr> const &nodes, shared_aux_ptr const &win,
+                 shared_node_ptr const &param, std::span<size_t const> grp_offset) {
+    // One arena bump per group: the within-group layout is fixed by
+    // init_arena, so slice the block by the precomputed offsets instead of
+    // paying allocate's alignment math and bounds check per node. The
+    // block alignment covers every entity and keeps the group start
+    // cacheline-aligned.
     for (size_t igrp = 0; igrp < n_grp; ++igrp) {
-      grp_aligned = false;
+      auto base = static_cast<std::byte *>(arena.allocate(node_grp_size, grp_align));
+      size_t e = 0;
       if constexpr (!std::is_void_v<aux_type>)
         if (win) {
-          auto win_size = win->clone_size();
-          auto win_align = win->clone_align();
-          if (!grp_aligned) {
-            win_align = std::max(cacheline_size, win_align);
-            grp_aligned = true;
-          }
-          mem = arena.allocate(win_size, win_align);
-          win_ptrs.emplace_back(win->clone_at(mem));
+          win_ptrs.emplace_back(win->clone_at(base + grp_offset[e++]));
         }
       if (param) {
-        auto par_size = param->clone_size();
-        auto par_align = param->clone_align();
-        if (!grp_aligned) {
-          par_align = std::max(cacheline_size, par_align);
-          grp_aligned = true;
-        }
-        mem = arena.allocate(par_size, par_align);
-        param_ptrs.emplace_back(param->clone_at(mem));
+        param_ptrs.emplace_back(param->clone_at(base + grp_offset[e++]));
       }
       for (size_t i = 0; i < nodes.size(); ++i) {
-        auto node_size = nodes[i]->clone_size();
-        auto node_align = nodes[i]->clone_align();
-        if (!grp_aligned) {
-          node_align = std::max(cacheline_size, node_align);
-          grp_aligned = true;
-        }
-        mem = arena.allocate(node_size, node_align);
-        node_ptrs.emplace_back(nodes[i]->clone_at(mem));
+        node_ptrs.emplace_back(nodes[i]->clone_at(base + grp_offset[e + i]));
       }
     }
   }
 
   size_t const n_grp;
   size_t const n_nodes;
+  size_t node_grp_size = 0;            ///< bytes per group block, see init_arena
+  size_t grp_align = cacheline_size;   ///< alignment of each group block
   std::pmr::vector<unique_aux_ptr> win_ptrs;
   std::pmr::vector<unique_node_ptr> param_ptrs;
   std::pmr::vector<unique_node_ptr> node_ptrs;
 
-  using u32_alloc = rebind_alloc<Alloc, u32>;
+  using u32_alloc = std::pmr::polymorphic_allocator<u32>;
 
 public:
   u32 record_size;                                  // total size of record
   u32 param_size;                                   // total size of param record
-  std::vector<u32, u32_alloc> record_offset;        // i-th node -> write offset in rec
+  std::pmr::vector<u32> record_offset;              // i-th node -> write offset in rec
   flat_multivect<u32, u32, u32_alloc> input_offset; // i-th node -> [read offset in rec], 0-th is aux args if exists
-  std::vector<u32, u32_alloc> output_offset;        // i-th output -> offset in rec
-  std::vector<u32, u32_alloc> param_node;           // node ids that connect to param root
+  std::pmr::vector<u32> output_offset;              // i-th output -> offset in rec
+  std::pmr::vector<u32> param_node;                 // node ids that connect to param root
   flat_multivect<u32, u32, u32_alloc> param_port;   // i-th param node -> [port in param root]
 };
 } // namespace opflow::detail
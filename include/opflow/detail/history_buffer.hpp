@@ -24,6 +24,7 @@ private:
   std::vector<T, alloc_type> buffer; ///< Circular buffer for storing records: record = [time, data...]
   size_type record_size;             ///< Size of each record
   size_type capacity;                ///< Current capacity of the buffer (in records)
+  size_type mask;                    ///< capacity - 1, cached for the index wrap on every access
   size_type head;                    ///< Index of the head element
   size_type count;                   ///< Number of valid elements
 
@@ -33,7 +34,7 @@ public:
   history_buffer() = default;
 
   history_buffer(size_type val_size, size_type init_cap, Alloc const &alloc = Alloc())
-      : buffer(alloc), record_size(val_size + 1), capacity(next_pow2(init_cap)), head(), count() {
+      : buffer(alloc), record_size(val_size + 1), capacity(next_pow2(init_cap)), mask(capacity - 1), head(), count() {
     // Check for potential overflow in value allocation
     if (record_size == 0 || capacity > std::numeric_limits<size_type>::max() / record_size) {
       throw std::bad_alloc();
@@ -84,7 +85,7 @@ public:
   void pop() noexcept {
     if (count == 0)
       return;
-    head = (head + 1) & (capacity - 1);
+    head = (head + 1) & mask;
     --count;
   }
 
@@ -142,7 +143,7 @@ private:
 
     // Copy existing data in order using at most 2 copies
     if (count > 0) {
-      size_type tail_idx = (head + count - 1) & (capacity - 1);
+      size_type tail_idx = (head + count - 1) & mask;
 
       if (head <= tail_idx) {
         // Data is contiguous: [head...tail]
@@ -169,11 +170,12 @@ private:
     }
     buffer = std::move(new_buffer);
     capacity = new_capacity;
+    mask = capacity - 1;
     head = 0; // Reset head since we linearised the data
   }
 
   size_type record_offset(size_type idx) const noexcept {
-    size_type actual_idx = (head + idx) & (capacity - 1);
+    size_type actual_idx = (head + idx) & mask;
     return actual_idx * record_size;
   }
 
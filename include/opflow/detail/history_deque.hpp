@@ -3,6 +3,7 @@
 #include <cassert>
 #include <deque>
 #include <span>
+#include <tuple>
 #include <vector>
 
 #include "iterator.hpp"
@@ -2,6 +2,7 @@
 
 #include <bit>
 #include <cassert>
+#include <limits>
 #include <span>
 #include <vector>
 
@@ -33,6 +34,7 @@ private:
   std::vector<U> value; ///< Values for each step, ring buffer
   size_type value_size; ///< Size of each value vector
   size_type capacity;   ///< Current capacity of the ring buffer (always power of 2)
+  size_type mask;       ///< capacity - 1, cached for the index wrap on every access
   size_type head;       ///< Index of the first valid element
   size_type count;      ///< Number of valid elements
 
@@ -46,6 +48,7 @@ public:
       : value_size(val_size), head(0), count(0) {
 
     capacity = next_pow2(initial_capacity);
+    mask = capacity - 1;
     // Check for potential overflow in value allocation
     if (value_size == 0 || capacity > std::numeric_limits<size_type>::max() / value_size) {
       throw std::bad_alloc();
@@ -61,6 +64,7 @@ public:
     count = 0;
 
     capacity = next_pow2(initial_capacity);
+    mask = capacity - 1;
     // Check for potential overflow in value allocation
     if (value_size == 0 || capacity > std::numeric_limits<size_type>::max() / value_size) {
       throw std::bad_alloc();
@@ -86,7 +90,7 @@ public:
       resize(capacity * 2);
     }
 
-    size_type tail_idx = (head + count) & (capacity - 1); // Use mask for fast modulo
+    size_type tail_idx = (head + count) & mask; // Use mask for fast modulo
     tick[tail_idx] = t;
 
     // Copy data to the value buffer
@@ -110,7 +114,7 @@ public:
       resize(capacity * 2);
     }
 
-    size_type tail_idx = (head + count) & (capacity - 1); // Use mask for fast modulo
+    size_type tail_idx = (head + count) & mask; // Use mask for fast modulo
     tick[tail_idx] = t;
 
     // Get mutable span for the value buffer
@@ -126,7 +130,7 @@ public:
     if (count == 0)
       return;
 
-    head = (head + 1) & (capacity - 1);
+    head = (head + 1) & mask;
     --count;
   }
 
@@ -134,7 +138,7 @@ public:
   value_type operator[](size_type idx) {
     assert(idx < count && "Index out of bounds");
 
-    size_type actual_idx = (head + idx) & (capacity - 1);
+    size_type actual_idx = (head + idx) & mask;
     size_type value_start = actual_idx * value_size;
     return {tick[actual_idx], {value.data() + value_start, value_size}};
   }
@@ -142,7 +146,7 @@ public:
   const_value_type operator[](size_type idx) const {
     assert(idx < count && "Index out of bounds");
 
-    size_type actual_idx = (head + idx) & (capacity - 1);
+    size_type actual_idx = (head + idx) & mask;
     size_type value_start = actual_idx * value_size;
     return {tick[actual_idx], {value.data() + value_start, value_size}};
   }
@@ -170,14 +174,14 @@ public:
 
   value_type back() {
     assert(count > 0 && "Index out of bounds");
-    size_type back_idx = (head + count - 1) & (capacity - 1);
+    size_type back_idx = (head + count - 1) & mask;
     size_type value_start = back_idx * value_size;
     return {tick[back_idx], {value.data() + value_start, value_size}};
   }
 
   const_value_type back() const {
     assert(count > 0 && "Index out of bounds");
-    size_type back_idx = (head + count - 1) & (capacity - 1);
+    size_type back_idx = (head + count - 1) & mask;
     size_type value_start = back_idx * value_size;
     return {tick[back_idx], {value.data() + value_start, value_size}};
   }
@@ -232,7 +236,7 @@ private:
 
     // Copy existing data in order using at most 2 copies
     if (count > 0) {
-      size_type tail_idx = (head + count - 1) & (capacity - 1);
+      size_type tail_idx = (head + count - 1) & mask;
 
       if (head <= tail_idx) {
         // Data is contiguous: [head...tail]
@@ -274,6 +278,7 @@ private:
     tick = std::move(new_tick);
     value = std::move(new_value);
     capacity = new_capacity;
+    mask = capacity - 1;
     head = 0; // Reset head since we linearized the data
   }
 };
@@ -1,8 +1,11 @@
 #pragma once
 
 #include <algorithm>
+#include <ranges>
 #include <vector>
 
+#include "utils.hpp"
+
 namespace opflow::detail {
 template <typename T, size_t BIN_THRES = 100, typename Alloc = std::allocator<T>>
 class sorted_vect : public std::vector<T, Alloc> {
@@ -14,24 +17,51 @@ public:
   using typename base::difference_type;
   using typename base::size_type;
 
+private:
+  // Window for the linear finish of the hybrid search: one cache line's
+  // worth of elements (at least 4 for oversized T).
+  static constexpr size_type LINEAR_WIN = cacheline_size / sizeof(T) > 4 ? cacheline_size / sizeof(T) : 4;
+
+  // lower_bound position, but halving stops once the window fits in a cache
+  // line and a linear scan finishes — the last log2(line/elem) halvings are
+  // the ones whose branches mispredict, and the final line is one fetch.
+  size_type lower_rank(T const &value) const {
+    size_type lo = 0;
+    size_type len = base::size();
+    while (len > LINEAR_WIN) {
+      size_type half = len / 2;
+      if ((*this)[lo + half] < value) {
+        lo += half + 1;
+        len -= half + 1;
+      } else {
+        len = half;
+      }
+    }
+    while (len != 0 && (*this)[lo] < value) {
+      ++lo;
+      --len;
+    }
+    return lo;
+  }
+
+public:
   size_type rank(T const &value) const {
-    auto dist = static_cast<difference_type>(base::size());
+    auto dist = base::size();
     if (base::size() > BIN_THRES) {
-      auto it = std::lower_bound(base::begin(), base::end(), value);
-      if (it != base::end() && *it == value) {
-        dist = std::distance(base::begin(), it);
+      auto r = lower_rank(value);
+      if (r < base::size() && (*this)[r] == value) {
+        dist = r;
       }
     } else {
       auto it = std::find(base::begin(), base::end(), value);
-      dist = std::distance(base::begin(), it);
+      dist = static_cast<size_type>(std::distance(base::begin(), it));
     }
-    return static_cast<size_type>(dist);
+    return dist;
   }
 
   void push(T const &value) {
     if (base::size() > BIN_THRES) {
-      auto it = std::lower_bound(base::begin(), base::end(), value);
-      base::insert(it, value);
+      base::insert(base::begin() + static_cast<difference_type>(lower_rank(value)), value);
     } else {
       auto it = std::find_if(base::begin(), base::end(), [&value](T const &elem) { return elem >= value; });
       base::insert(it, value);
@@ -40,17 +70,26 @@ public:
 
   void push(T &&value) {
     if (base::size() > BIN_THRES) {
-      auto it = std::lower_bound(base::begin(), base::end(), value);
-      base::insert(it, std::move(value));
+      base::insert(base::begin() + static_cast<difference_type>(lower_rank(value)), std::move(value));
     } else {
       auto it = std::find_if(base::begin(), base::end(), [&value](T const &elem) { return elem >= value; });
       base::insert(it, std::move(value));
     }
   }
 
+  // Insert a batch in one pass: append, sort the new tail, merge in place.
+  // O(n + m log m) instead of m separate O(n) shifting inserts.
+  template <std::ranges::input_range R>
+  void push_bulk(R &&src) {
+    auto const mid = static_cast<difference_type>(base::size());
+    base::insert(base::end(), std::ranges::begin(src), std::ranges::end(src));
+    std::sort(base::begin() + mid, base::end());
+    std::inplace_merge(base::begin(), base::begin() + mid, base::end());
+  }
+
   void erase(T const &value) {
     if (base::size() > BIN_THRES) {
-      auto it = std::lower_bound(base::begin(), base::end(), value);
+      auto it = base::begin() + static_cast<difference_type>(lower_rank(value));
       if (it != base::end() && *it == value) {
         base::erase(it);
       }
@@ -1,9 +1,13 @@
 #pragma once
 
 #include <bit>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <variant>
 #include <vector>
 
 namespace opflow::detail {
@@ -22,7 +26,35 @@ struct overload : Ts... {
 template <typename... Ts>
 overload(Ts...) -> overload<Ts...>;
 
-constexpr inline size_t aligned_size(size_t size, size_t align) noexcept { return (size + align - 1) & ~(align - 1); }
+// std::visit routes through a function-pointer dispatch table the inliner
+// often cannot see through. For the small variants on streaming hot paths,
+// probe the index with a compare chain instead so each alternative becomes a
+// direct, inlinable call. Precondition: v is not valueless_by_exception.
+template <size_t I = 0, typename F, typename V>
+constexpr decltype(auto) visit_fast(F &&f, V &&v) {
+  constexpr size_t n = std::variant_size_v<std::remove_cvref_t<V>>;
+  static_assert(I < n);
+  if constexpr (I + 1 == n) {
+    return std::forward<F>(f)(*std::get_if<I>(&v));
+  } else {
+    if (v.index() == I)
+      return std::forward<F>(f)(*std::get_if<I>(&v));
+    return visit_fast<I + 1>(std::forward<F>(f), std::forward<V>(v));
+  }
+}
+
+// align must be a power of two — the mask identity below is wrong otherwise
+constexpr inline size_t aligned_size(size_t size, size_t align) noexcept {
+  assert(std::has_single_bit(align) && "[BUG] aligned_size requires a power-of-two alignment.");
+#if defined(__GNUC__) || defined(__clang__)
+  // Make the precondition visible to the optimizer (and a hard error in
+  // constant evaluation): with it, ~(align - 1) folds to an immediate for
+  // constant alignments such as alignof(T)
+  if (!std::has_single_bit(align))
+    __builtin_unreachable();
+#endif
+  return (size + align - 1) & ~(align - 1);
+}
 
 template <typename T>
 struct ptr_hash {
@@ -34,11 +66,40 @@ struct ptr_hash {
   std::size_t operator()(std::unique_ptr<T> const &ptr) const noexcept { return std::hash<T const *>()(ptr.get()); }
 };
 
+// fasthash64 (Zilong Tan, MIT). Word-at-a-time with a strong xorshift-mul
+// mixer: for the short identifier-like keys used as node names this avoids
+// the byte-wise tail handling of the standard library hashes, and unaligned
+// loads go through memcpy which compiles to a single mov on mainstream
+// targets. The zero-padded tail load is equivalent to the reference switch.
+constexpr inline std::uint64_t fasthash_mix(std::uint64_t h) noexcept {
+  h ^= h >> 23;
+  h *= 0x2127599bf4325c37ull;
+  h ^= h >> 47;
+  return h;
+}
+
+inline std::uint64_t fasthash64(char const *p, std::size_t len) noexcept {
+  constexpr std::uint64_t m = 0x880355f21e6d1965ull;
+  std::uint64_t h = 0x9e3779b97f4a7c15ull ^ (len * m);
+  std::size_t const n8 = len & ~std::size_t{7};
+  for (std::size_t i = 0; i < n8; i += 8) {
+    std::uint64_t v;
+    std::memcpy(&v, p + i, 8);
+    h = (h ^ fasthash_mix(v)) * m;
+  }
+  if (len & 7) {
+    std::uint64_t v = 0;
+    std::memcpy(&v, p + n8, len & 7);
+    h = (h ^ fasthash_mix(v)) * m;
+  }
+  return fasthash_mix(h);
+}
+
 struct str_hash {
   using is_transparent = void; ///< Enable transparent hashing
-  std::size_t operator()(std::string_view str) const noexcept { return std::hash<std::string_view>{}(str); }
-  std::size_t operator()(std::string const &str) const noexcept { return std::hash<std::string>{}(str); }
-  std::size_t operator()(char const *str) const noexcept { return std::hash<std::string_view>{}(str); }
+  std::size_t operator()(std::string_view str) const noexcept { return fasthash64(str.data(), str.size()); }
+  std::size_t operator()(std::string const &str) const noexcept { return fasthash64(str.data(), str.size()); }
+  std::size_t operator()(char const *str) const noexcept { return (*this)(std::string_view{str}); }
 };
 
 #if defined(__cpp_lib_hardware_interference_size) && __cpp_lib_hardware_interference_size >= 201703L
@@ -57,6 +118,10 @@ constexpr inline size_t cacheline_size = 64; // Default to 64 bytes
 constexpr inline size_t cacheline_shift = std::countr_zero(cacheline_size);
 constexpr inline size_t cacheline_mask = cacheline_size - 1;
 
+// L1 set stride (capacity / associativity): blocks laid out at a multiple of
+// this stride map to the same cache sets. 32 KiB / 8 ways on mainstream cores.
+constexpr inline size_t l1_way_stride = 4096;
+
 template <typename T, typename A>
 size_t heap_alloc_size(std::vector<T, A> const &, size_t intended_size) noexcept {
   return aligned_size(sizeof(T) * intended_size, alignof(T));
@@ -73,6 +138,29 @@ struct alignas(Align) aligned_type : public T {
 template <typename Alloc, typename T>
 using rebind_alloc = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
 
+// Allocator adaptor whose value-less construct() default-initializes instead
+// of value-initializing: vector::resize on trivial T skips the memset. Used
+// for arena backing buffers that are overwritten by placement-new anyway.
+template <typename T, typename A = std::allocator<T>>
+struct default_init_alloc : public A {
+  template <typename U>
+  struct rebind {
+    using other = default_init_alloc<U, rebind_alloc<A, U>>;
+  };
+
+  using A::A;
+  default_init_alloc(A const &a) noexcept : A(a) {}
+
+  template <typename U>
+  void construct(U *ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+    ::new (static_cast<void *>(ptr)) U;
+  }
+  template <typename U, typename... Args>
+  void construct(U *ptr, Args &&...args) {
+    std::allocator_traits<A>::construct(static_cast<A &>(*this), ptr, std::forward<Args>(args)...);
+  }
+};
+
 template <typename T>
 concept string_like = std::convertible_to<T, std::string_view>;
 
@@ -3,6 +3,11 @@
 #include <algorithm>
 #include <cmath>
 #include <concepts>
+#include <cstddef>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
 
 namespace opflow::detail {
 template <std::floating_point U>
@@ -39,6 +44,262 @@ inline U fmod(U a, U b) noexcept {
   return std::fmod(a, b);
 }
 
+/**
+ * @brief Sum two equal-length double streams in one fused pass
+ *
+ * Both streams stay in flight per iteration, so intermediate sums live in
+ * registers and each input line is touched once. With AVX2 the loop retires
+ * one 4-wide add per stream per iteration instead of a serialized addsd
+ * chain; otherwise a scalar loop with the same single-pass shape is used.
+ */
+inline void sum2(double const *a, double const *b, size_t n, double &sum_a, double &sum_b) noexcept {
+  double sa{};
+  double sb{};
+  size_t i = 0;
+#if defined(__AVX2__)
+  if (n >= 4) {
+    // Two accumulators per stream break the 4-cycle addpd latency chain;
+    // more buys nothing here since large windows are load-bandwidth bound.
+    __m256d va = _mm256_setzero_pd();
+    __m256d va1 = _mm256_setzero_pd();
+    __m256d vb = _mm256_setzero_pd();
+    __m256d vb1 = _mm256_setzero_pd();
+    for (; i + 8 <= n; i += 8) {
+      va = _mm256_add_pd(va, _mm256_loadu_pd(a + i));
+      va1 = _mm256_add_pd(va1, _mm256_loadu_pd(a + i + 4));
+      vb = _mm256_add_pd(vb, _mm256_loadu_pd(b + i));
+      vb1 = _mm256_add_pd(vb1, _mm256_loadu_pd(b + i + 4));
+    }
+    for (; i + 4 <= n; i += 4) {
+      va = _mm256_add_pd(va, _mm256_loadu_pd(a + i));
+      vb = _mm256_add_pd(vb, _mm256_loadu_pd(b + i));
+    }
+    va = _mm256_add_pd(va, va1);
+    vb = _mm256_add_pd(vb, vb1);
+    // narrow to 128-bit before reducing: two cross-lane hadds are slower
+    __m128d lo = _mm_add_pd(_mm256_castpd256_pd128(va), _mm256_extractf128_pd(va, 1));
+    sa = _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+    lo = _mm_add_pd(_mm256_castpd256_pd128(vb), _mm256_extractf128_pd(vb, 1));
+    sb = _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+  }
+#endif
+  for (; i < n; ++i) {
+    sa += a[i];
+    sb += b[i];
+  }
+  sum_a = sa;
+  sum_b = sb;
+}
+
+/**
+ * @brief Fused min/max over one double stream in a single pass
+ *
+ * Finding min and max separately walks the data twice; one pass with paired
+ * vminpd/vmaxpd accumulators halves the bytes loaded and retires both
+ * reductions per load. n must be greater than 0.
+ */
+inline void minmax(double const *a, size_t n, double &min_out, double &max_out) noexcept {
+  size_t i = 0;
+  double mn = a[0];
+  double mx = a[0];
+#if defined(__AVX2__)
+  if (n >= 4) {
+    __m256d vmin = _mm256_loadu_pd(a);
+    __m256d vmax = vmin;
+    for (i = 4; i + 4 <= n; i += 4) {
+      __m256d v = _mm256_loadu_pd(a + i);
+      vmin = _mm256_min_pd(vmin, v);
+      vmax = _mm256_max_pd(vmax, v);
+    }
+    __m128d lo = _mm_min_pd(_mm256_castpd256_pd128(vmin), _mm256_extractf128_pd(vmin, 1));
+    mn = _mm_cvtsd_f64(_mm_min_sd(lo, _mm_unpackhi_pd(lo, lo)));
+    lo = _mm_max_pd(_mm256_castpd256_pd128(vmax), _mm256_extractf128_pd(vmax, 1));
+    mx = _mm_cvtsd_f64(_mm_max_sd(lo, _mm_unpackhi_pd(lo, lo)));
+  }
+#endif
+  for (; i < n; ++i) {
+    mn = std::min(mn, a[i]);
+    mx = std::max(mx, a[i]);
+  }
+  min_out = mn;
+  max_out = mx;
+}
+
+/**
+ * @brief Fused dot product and sum over two double streams
+ *
+ * Computes sum(a[i] * b[i]) and sum(b[i]) in one pass, the VWAP kernel.
+ * Same accumulator discipline as sum2; the product side uses FMA when
+ * available so each element costs one fused op instead of mul + add.
+ */
+inline void dot_sum(double const *a, double const *b, size_t n, double &dot_ab, double &sum_b) noexcept {
+  double dot{};
+  double sb{};
+  size_t i = 0;
+#if defined(__AVX2__)
+  if (n >= 4) {
+    __m256d vd = _mm256_setzero_pd();
+    __m256d vd1 = _mm256_setzero_pd();
+    __m256d vb = _mm256_setzero_pd();
+    __m256d vb1 = _mm256_setzero_pd();
+    for (; i + 8 <= n; i += 8) {
+      __m256d b0 = _mm256_loadu_pd(b + i);
+      __m256d b1 = _mm256_loadu_pd(b + i + 4);
+#if defined(__FMA__)
+      vd = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), b0, vd);
+      vd1 = _mm256_fmadd_pd(_mm256_loadu_pd(a + i + 4), b1, vd1);
+#else
+      vd = _mm256_add_pd(vd, _mm256_mul_pd(_mm256_loadu_pd(a + i), b0));
+      vd1 = _mm256_add_pd(vd1, _mm256_mul_pd(_mm256_loadu_pd(a + i + 4), b1));
+#endif
+      vb = _mm256_add_pd(vb, b0);
+      vb1 = _mm256_add_pd(vb1, b1);
+    }
+    for (; i + 4 <= n; i += 4) {
+      __m256d b0 = _mm256_loadu_pd(b + i);
+#if defined(__FMA__)
+      vd = _mm256_fmadd_pd(_mm256_loadu_pd(a + i), b0, vd);
+#else
+      vd = _mm256_add_pd(vd, _mm256_mul_pd(_mm256_loadu_pd(a + i), b0));
+#endif
+      vb = _mm256_add_pd(vb, b0);
+    }
+    vd = _mm256_add_pd(vd, vd1);
+    vb = _mm256_add_pd(vb, vb1);
+    __m128d lo = _mm_add_pd(_mm256_castpd256_pd128(vd), _mm256_extractf128_pd(vd, 1));
+    dot = _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+    lo = _mm_add_pd(_mm256_castpd256_pd128(vb), _mm256_extractf128_pd(vb, 1));
+    sb = _mm_cvtsd_f64(_mm_add_sd(lo, _mm_unpackhi_pd(lo, lo)));
+  }
+#endif
+  for (; i < n; ++i) {
+    dot += a[i] * b[i];
+    sb += b[i];
+  }
+  dot_ab = dot;
+  sum_b = sb;
+}
+
+/**
+ * @brief One-pass Welford mean and sum of squared deviations
+ *
+ * The classic two-pass variance streams the window twice; this computes both
+ * moments in a single pass with the same numerical stability. With AVX2 four
+ * independent Welford states run in lockstep over strided lanes and are merged
+ * afterwards with Chan's parallel combine, so the loop still retires 4-wide
+ * loads. n must be greater than 0; m2_out is the raw M2, not yet divided.
+ */
+inline void welford(double const *a, size_t n, double &mean_out, double &m2_out) noexcept {
+  double mean{};
+  double m2{};
+  size_t count = 0;
+  size_t i = 0;
+#if defined(__AVX2__)
+  if (n >= 8) {
+    __m256d mean4 = _mm256_loadu_pd(a);
+    __m256d m24 = _mm256_setzero_pd();
+    size_t k = 1; // per-lane count; identical across lanes
+    for (i = 4; i + 4 <= n; i += 4, ++k) {
+      __m256d const v = _mm256_loadu_pd(a + i);
+      __m256d const d = _mm256_sub_pd(v, mean4);
+      mean4 = _mm256_add_pd(mean4, _mm256_mul_pd(d, _mm256_set1_pd(1.0 / static_cast<double>(k + 1))));
+      m24 = _mm256_add_pd(m24, _mm256_mul_pd(d, _mm256_sub_pd(v, mean4)));
+    }
+    alignas(32) double lm[4];
+    alignas(32) double lv[4];
+    _mm256_store_pd(lm, mean4);
+    _mm256_store_pd(lv, m24);
+    // Chan's combine: lanes have equal counts, merge pairwise then fold
+    mean = lm[0];
+    m2 = lv[0];
+    count = k;
+    for (size_t lane = 1; lane < 4; ++lane) {
+      double const delta = lm[lane] - mean;
+      double const nk = static_cast<double>(k);
+      double const nc = static_cast<double>(count);
+      mean += delta * nk / (nc + nk);
+      m2 += lv[lane] + delta * delta * nc * nk / (nc + nk);
+      count += k;
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    ++count;
+    double const d = a[i] - mean;
+    mean += d / static_cast<double>(count);
+    m2 += d * (a[i] - mean);
+  }
+  mean_out = mean;
+  m2_out = m2;
+}
+
+/**
+ * @brief One-pass co-moment Welford over two double streams
+ *
+ * Computes both running means and the raw co-moment
+ * C = sum((a[i] - mean_a) * (b[i] - mean_b)) in a single fused pass, so each
+ * pair of input cache lines is touched once instead of once per moment. Same
+ * lane discipline as welford: with AVX2 four independent states run over
+ * strided lanes and are merged with Chan's parallel combine. n must be
+ * greater than 0; c_out is the raw co-moment, not yet divided.
+ */
+inline void welford2(double const *a, double const *b, size_t n, double &mean_a_out, double &mean_b_out,
+                     double &c_out) noexcept {
+  double ma{};
+  double mb{};
+  double c{};
+  size_t count = 0;
+  size_t i = 0;
+#if defined(__AVX2__)
+  if (n >= 8) {
+    __m256d ma4 = _mm256_loadu_pd(a);
+    __m256d mb4 = _mm256_loadu_pd(b);
+    __m256d c4 = _mm256_setzero_pd();
+    size_t k = 1; // per-lane count; identical across lanes
+    for (i = 4; i + 4 <= n; i += 4, ++k) {
+      __m256d const va = _mm256_loadu_pd(a + i);
+      __m256d const vb = _mm256_loadu_pd(b + i);
+      __m256d const rinv = _mm256_set1_pd(1.0 / static_cast<double>(k + 1));
+      __m256d const da = _mm256_sub_pd(va, ma4);
+      ma4 = _mm256_add_pd(ma4, _mm256_mul_pd(da, rinv));
+      mb4 = _mm256_add_pd(mb4, _mm256_mul_pd(_mm256_sub_pd(vb, mb4), rinv));
+      c4 = _mm256_add_pd(c4, _mm256_mul_pd(da, _mm256_sub_pd(vb, mb4)));
+    }
+    alignas(32) double la[4];
+    alignas(32) double lb[4];
+    alignas(32) double lc[4];
+    _mm256_store_pd(la, ma4);
+    _mm256_store_pd(lb, mb4);
+    _mm256_store_pd(lc, c4);
+    // Chan's combine: lanes have equal counts, merge pairwise then fold
+    ma = la[0];
+    mb = lb[0];
+    c = lc[0];
+    count = k;
+    for (size_t lane = 1; lane < 4; ++lane) {
+      double const da = la[lane] - ma;
+      double const db = lb[lane] - mb;
+      double const nk = static_cast<double>(k);
+      double const nc = static_cast<double>(count);
+      ma += da * nk / (nc + nk);
+      mb += db * nk / (nc + nk);
+      c += lc[lane] + da * db * nc * nk / (nc + nk);
+      count += k;
+    }
+  }
+#endif
+  for (; i < n; ++i) {
+    ++count;
+    double const da = a[i] - ma;
+    ma += da / static_cast<double>(count);
+    mb += (b[i] - mb) / static_cast<double>(count);
+    c += da * (b[i] - mb);
+  }
+  mean_a_out = ma;
+  mean_b_out = mb;
+  c_out = c;
+}
+
 template <std::floating_point U>
 struct lerp {
   U const t;
@@ -30,6 +30,21 @@ struct fn_base : public cloneable {
   using data_type = T;
 
   virtual void on_data(data_type const *in, data_type *out) noexcept = 0;
+
+  /**
+   * @brief Process a batch of rows with one dispatch
+   *
+   * Rows are laid out at fixed strides. The default loops on_data, paying one
+   * indirect call per row; stateless functors can override with a tight loop
+   * so the engine pays a single dispatch for the whole batch.
+   */
+  virtual void on_data_batch(size_t n, data_type const *in, size_t in_stride, data_type *out,
+                             size_t out_stride) noexcept {
+    for (size_t i = 0; i < n; ++i) {
+      on_data(in + i * in_stride, out + i * out_stride);
+    }
+  }
+
   virtual void on_param(data_type const *param) noexcept { std::ignore = param; }
   virtual void reset() noexcept {}
 
@@ -56,6 +71,17 @@ struct fn_root : fn_base<T> {
     }
   }
 
+  void on_data_batch(size_t n, data_type const *in, size_t in_stride, data_type *out,
+                     size_t out_stride) noexcept override {
+    for (size_t r = 0; r < n; ++r) {
+      data_type *OPFLOW_RESTRICT cast = out + r * out_stride;
+      data_type const *row = in + r * in_stride;
+      for (size_t i = 0; i < input_size; ++i) {
+        cast[i] = row[i];
+      }
+    }
+  }
+
   OPFLOW_INOUT(input_size, input_size)
   OPFLOW_CLONEABLE(fn_root)
 };
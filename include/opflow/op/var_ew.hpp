@@ -23,12 +23,14 @@ public:
       return;
     }
 
+    // After m.add, x - m' = (1 - alpha) * d exactly, so the Welford-style
+    // input d * (x - m') equals a1 * d * d. Computing it from the pre-update
+    // mean keeps the s2 update independent of the m update instead of
+    // serializing behind it, which pipelines better on OoO cores.
     data_type const d = x - m;
-    // data_type const a1 = 1.0 - alpha;
+    data_type const a1 = data_type(1) - alpha;
     m.add(x, alpha);
-    // s2.add(a1 * d * d, alpha);
-    data_type const d2 = x - m;
-    s2.add(d * d2, alpha); // use Welford-like method for one less multiplication
+    s2.add(a1 * d * d, alpha);
   }
 
   void value(data_type *out) const noexcept override {
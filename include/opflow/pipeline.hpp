@@ -106,8 +106,9 @@ public:
         current_out = get_buffer(i, igrp);
       }
 
-      // Execute stage
-      auto emit_result = std::visit(
+      // Execute stage. visit_fast keeps the per-row dispatch a compare chain
+      // the inliner can flatten instead of std::visit's table indirection.
+      auto emit_result = detail::visit_fast(
           [&](auto *exec) -> std::optional<data_type> {
             using ExecType = std::decay_t<decltype(*exec)>;
 
@@ -29,6 +29,8 @@ public:
     return {.timestamp = time, .size = cnt, .offset = 0, .evict = cnt};
   }
 
+  size_t reserve_hint() const noexcept override { return window_size; }
+
   OPFLOW_CLONEABLE(counter);
 
 private:
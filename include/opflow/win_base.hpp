@@ -83,6 +83,15 @@ struct win_base : public cloneable {
    */
   virtual spec_type emit() noexcept = 0;
 
+  /**
+   * @brief Hint for how many data points the aggregator should buffer per window
+   *
+   * Executors use this to pre-reserve per-column capacity upfront and avoid
+   * reallocation churn during warmup. Returns 0 when the window size is
+   * data-dependent and not known in advance.
+   */
+  virtual size_t reserve_hint() const noexcept { return 0; }
+
   virtual win_base *clone_at(void *mem) const noexcept = 0;
 };
 
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithm>
+#include <cstdint>
 #include <optional>
 #include <random>
 #include <ranges>
@@ -73,6 +75,43 @@ auto make_unif_range(size_t n, T min, T max, std::optional<unsigned int> seed =
   }
 }
 
+// Fill a caller-owned buffer with uniform draws, bypassing the lazy range.
+// The generator state lives in registers across the whole fill, so the loop
+// body is just the PRNG step plus a scale — no iterator indirection per draw.
+template <arithmetic T>
+void fill_unif(T *out, size_t n, T min, T max, std::optional<unsigned int> seed = std::nullopt) {
+  // xorshift128+: two words of state vs mt19937's 2.5 KiB, fast enough that
+  // data generation stops registering in benchmark setup
+  uint64_t s0 = 0x9E3779B97F4A7C15ULL;
+  uint64_t s1 = 0xBF58476D1CE4E5B9ULL;
+  if (seed.has_value()) {
+    s0 ^= seed.value();
+  } else {
+    std::random_device rd;
+    s0 ^= (static_cast<uint64_t>(rd()) << 32) | rd();
+  }
+  auto next = [&]() noexcept {
+    uint64_t x = s0;
+    uint64_t const y = s1;
+    s0 = y;
+    x ^= x << 23;
+    s1 = x ^ y ^ (x >> 17) ^ (y >> 26);
+    return s1 + y;
+  };
+
+  if constexpr (std::floating_point<T>) {
+    T const scale = (max - min) * static_cast<T>(0x1.0p-53);
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = min + static_cast<T>(next() >> 11) * scale;
+    }
+  } else {
+    auto const span = static_cast<uint64_t>(max - min) + 1;
+    for (size_t i = 0; i < n; ++i) {
+      out[i] = min + static_cast<T>(next() % span);
+    }
+  }
+}
+
 template <typename Range>
 auto make_unif_choice(size_t n, Range &&choices, std::optional<unsigned int> seed = std::nullopt) {
   std::mt19937 gen;
@@ -1,5 +1,6 @@
 #include "opflow/chrono.hpp"
 #include "opflow/chrono/chrono.hpp"
+#include "opflow/chrono/duration_series.hpp"
 #include <chrono>
 #include <gtest/gtest.h>
 
@@ -242,6 +243,66 @@ TEST_F(ChronoTest, DurationCasting) {
   EXPECT_EQ(h2.count(), 24);
 }
 
+TEST_F(ChronoTest, BulkTickConversion) {
+  // Exact direction (seconds -> milliseconds): pure multiply path
+  int64_t src[5] = {0, 1, 2, -3, 1000};
+  int64_t dst[5] = {};
+  convert_ticks(src, dst, 5, second, milli);
+  EXPECT_EQ(dst[0], 0);
+  EXPECT_EQ(dst[1], 1000);
+  EXPECT_EQ(dst[2], 2000);
+  EXPECT_EQ(dst[3], -3000);
+  EXPECT_EQ(dst[4], 1000000);
+
+  // Inexact direction (milliseconds -> seconds): truncation toward zero
+  int64_t ms[4] = {1500, -1500, 999, 60000};
+  int64_t s[4] = {};
+  convert_ticks(ms, s, 4, milli, second);
+  EXPECT_EQ(s[0], 1);
+  EXPECT_EQ(s[1], -1);
+  EXPECT_EQ(s[2], 0);
+  EXPECT_EQ(s[3], 60);
+
+  // Same period degenerates to a copy
+  convert_ticks(src, dst, 5, minute, minute);
+  for (int i = 0; i < 5; ++i) {
+    EXPECT_EQ(dst[i], src[i]);
+  }
+
+  // Agrees with duration_cast element-wise
+  for (int64_t v : {int64_t{1}, int64_t{-7}, int64_t{86400}}) {
+    int64_t out = 0;
+    convert_ticks(&v, &out, 1, hour, minute);
+    EXPECT_EQ(out, duration_cast<minutes>(duration<int64_t>(v, hour)).count());
+  }
+}
+
+TEST_F(ChronoTest, DurationSeries) {
+  duration_series<int64_t> series(milli);
+  EXPECT_TRUE(series.empty());
+
+  series.push_back(1500);
+  series.push_back(duration<int64_t>(2, second)); // converted to 2000 ms
+  series.push_back(-500);
+  EXPECT_EQ(series.size(), 3u);
+
+  EXPECT_EQ(series[0].count(), 1500);
+  EXPECT_EQ(series[1].count(), 2000);
+  EXPECT_EQ(series[2].count(), -500);
+
+  EXPECT_EQ(series.sum().count(), 3000);
+  EXPECT_EQ(series.min().count(), -500);
+  EXPECT_EQ(series.max().count(), 2000);
+
+  // Bulk conversion to a coarser period truncates toward zero
+  auto in_seconds = series.converted(second);
+  EXPECT_EQ(in_seconds.get_period().num, 1);
+  EXPECT_EQ(in_seconds.get_period().denom, 1);
+  EXPECT_EQ(in_seconds[0].count(), 1);
+  EXPECT_EQ(in_seconds[1].count(), 2);
+  EXPECT_EQ(in_seconds[2].count(), 0);
+}
+
 // ========================================
 // TIME_POINT TESTS
 // ========================================
@@ -88,6 +88,49 @@ TEST_F(FlatSetTest, DuplicateInsertionWithOtherElements) {
   EXPECT_EQ(fs[2], 30);
 }
 
+TEST_F(FlatSetTest, BulkInsert) {
+  flat_set<int> fs;
+
+  std::vector<int> values{30, 10, 30, 20, 10, 40};
+  size_t inserted = fs.bulk_insert(values.begin(), values.end());
+
+  EXPECT_EQ(inserted, 4);
+  EXPECT_EQ(fs.size(), 4);
+
+  // First occurrences survive in insertion order
+  EXPECT_EQ(fs[0], 30);
+  EXPECT_EQ(fs[1], 10);
+  EXPECT_EQ(fs[2], 20);
+  EXPECT_EQ(fs[3], 40);
+}
+
+TEST_F(FlatSetTest, BulkInsertAgainstExisting) {
+  flat_set<int> fs;
+
+  fs.insert(10);
+  fs.insert(20);
+
+  std::vector<int> values{20, 30, 10, 40};
+  size_t inserted = fs.bulk_insert(values.begin(), values.end());
+
+  EXPECT_EQ(inserted, 2);
+  EXPECT_EQ(fs.size(), 4);
+
+  EXPECT_EQ(fs[0], 10);
+  EXPECT_EQ(fs[1], 20);
+  EXPECT_EQ(fs[2], 30);
+  EXPECT_EQ(fs[3], 40);
+}
+
+TEST_F(FlatSetTest, BulkInsertEmptyRange) {
+  flat_set<int> fs;
+  fs.insert(10);
+
+  std::vector<int> values;
+  EXPECT_EQ(fs.bulk_insert(values.begin(), values.end()), 0);
+  EXPECT_EQ(fs.size(), 1);
+}
+
 TEST_F(FlatSetTest, EmplaceForwarding) {
   flat_set<std::string> fs;
 
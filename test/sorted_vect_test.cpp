@@ -267,3 +267,26 @@ TEST_F(SortedVectTest, CharType) {
   std::vector<char> expected = {'e', 'h', 'l', 'l', 'o'};
   EXPECT_EQ(std::vector<char>(sv.begin(), sv.end()), expected);
 }
+
+// Test bulk insertion merges with existing content
+TEST_F(SortedVectTest, PushBulk) {
+  sorted_vect<int> sv;
+  for (int val : {5, 1, 9, 3}) {
+    sv.push(val);
+  }
+
+  std::vector<int> batch = {4, 0, 7, 2, 10};
+  sv.push_bulk(batch);
+
+  EXPECT_TRUE(std::is_sorted(sv.begin(), sv.end()));
+  EXPECT_EQ(sv.size(), 9);
+
+  std::vector<int> expected = {0, 1, 2, 3, 4, 5, 7, 9, 10};
+  EXPECT_EQ(std::vector<int>(sv.begin(), sv.end()), expected);
+
+  // Bulk insert into empty container
+  sorted_vect<int> sv2;
+  sv2.push_bulk(batch);
+  EXPECT_TRUE(std::is_sorted(sv2.begin(), sv2.end()));
+  EXPECT_EQ(sv2.size(), batch.size());
+}